@@ -119,6 +119,20 @@ local create_test_projects = function(name, is_library, common_settings)
 
 		table.insert(test_projects, name.."-functional-test")
 	end
+
+	if not table.isempty(os.matchfiles(source_dir("benchmark").."**.cpp")) then
+		create_source_project(name.."-benchmark", "benchmark")
+			kind "ConsoleApp"
+			targetdir(target_dir_path("benchmarks"))
+			includedirs { source_dir("main") }
+			if is_library then
+				links(name)
+			end
+			if common_settings then
+				common_settings()
+			end
+		project "*"
+	end
 end
 
 local gather_headers = function()
@@ -19,15 +19,21 @@ graphics::Device::Configuration graphicsDeviceConfiguration() {
 	return configuration;
 }
 
+// Relative to the working directory
+const auto SHADER_CACHE_DIRECTORY = "shader-cache";
+
 } // anonymous namespace
 
 App::App(const wm::MainArguments& mainArguments, const wm::Window::Configuration& mainWindowConfiguration) :
 	wmApp_(mainArguments),
 	mainWindow_(mainWindowConfiguration, essentials::make_observer(&wmApp_)),
 	graphicsDevice_(mainWindow_.handle(), graphicsDeviceConfiguration()),
+	shaderCache_(SHADER_CACHE_DIRECTORY),
+	techniqueCompiler_(graphicsDevice_, shaderCache_, threadPool_),
 	imguiHost_(
 		time::Timer(essentials::make_observer(&clock_)),
 		graphicsDevice_,
+		techniqueCompiler_,
 		mainWindow_.clientWidth(),
 		mainWindow_.clientHeight()
 		)
@@ -48,7 +54,10 @@ void App::update() {
 	graphicsDevice_.beginScene();
 
 	{
-		imguiHost_.render(graphicsDevice_, rendererCommandBuffer_);
+		{
+			auto lease = rendererCommandBuffer_.lease();
+			imguiHost_.render(graphicsDevice_, lease.buffer());
+		}
 
 		rendererCommandBuffer_.submit(graphicsDevice_.getImmediateCommandList());
 	}
@@ -4,8 +4,11 @@
 #include "dormouse-engine/wm/App.hpp"
 #include "dormouse-engine/wm/Window.hpp"
 #include "dormouse-engine/graphics/Device.hpp"
-#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/command/ParallelCommandBuffer.hpp"
 #include "dormouse-engine/renderer/control/ResourceView.hpp"
+#include "dormouse-engine/essentials/ThreadPool.hpp"
+#include "dormouse-engine/renderer/shader/ShaderCache.hpp"
+#include "dormouse-engine/renderer/shader/TechniqueCompiler.hpp"
 #include "../time/WallClock.hpp"
 #include "ImGuiHost.hpp"
 
@@ -36,7 +39,13 @@ private:
 
 	graphics::Device graphicsDevice_;
 
-	renderer::command::CommandBuffer rendererCommandBuffer_;
+	renderer::shader::ShaderCache shaderCache_;
+
+	essentials::ThreadPool threadPool_;
+
+	renderer::shader::TechniqueCompiler techniqueCompiler_;
+
+	renderer::command::ParallelCommandBuffer rendererCommandBuffer_;
 
 	ImGuiHost imguiHost_;
 
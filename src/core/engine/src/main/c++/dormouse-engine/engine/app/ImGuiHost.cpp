@@ -138,35 +138,19 @@ graphics::Buffer createImguiConstantBuffer(graphics::Device& graphicsDevice, siz
 		);
 }
 
-renderer::shader::Technique createImguiTechnique(graphics::Device& graphicsDevice) {
-	auto technique = renderer::shader::Technique();
-
-	auto flags = graphics::ShaderCompiler::CompilerFlags();
+renderer::shader::Technique createImguiTechnique(renderer::shader::TechniqueCompiler& techniqueCompiler) {
+	auto description = renderer::shader::TechniqueCompiler::Description();
+	description.code = essentials::viewBuffer(IMGUI_TECHNIQUE_CODE);
+	description.name = "imgui";
+	description.vertexShaderEntrypoint = "vs";
+	description.pixelShaderEntrypoint = "ps";
+	description.inputLayoutElements = createInputLayoutElements();
 
 	if (essentials::IS_DEBUG) {
-		flags = graphics::ShaderCompiler::FULL_DEBUG_MASK;
-	}
-
-	auto shaderCompiler = graphics::ShaderCompiler(flags);
-
-	{
-		auto compiledVertexShader = shaderCompiler.compile(
-			essentials::viewBuffer(IMGUI_TECHNIQUE_CODE), "imgui", "vs", graphics::ShaderType::VERTEX);
-		technique.setShader(
-			renderer::shader::VertexShader(graphicsDevice, essentials::viewBuffer(compiledVertexShader)));
-
-		auto inputLayout = renderer::shader::InputLayout(graphicsDevice, createInputLayoutElements());
-		technique.setInputLayout(std::move(inputLayout));
-	}
-
-	{
-		auto compiledPixelShader = shaderCompiler.compile(
-			essentials::viewBuffer(IMGUI_TECHNIQUE_CODE), "imgui", "ps", graphics::ShaderType::PIXEL);
-		technique.setShader(
-			renderer::shader::PixelShader(graphicsDevice, essentials::viewBuffer(compiledPixelShader)));
+		description.flags = graphics::ShaderCompiler::FULL_DEBUG_MASK;
 	}
 
-	return technique;
+	return techniqueCompiler.compile(std::move(description)).get();
 }
 
 renderer::control::Control createRenderControl(graphics::Device& graphicsDevice, size_t width, size_t height) {
@@ -208,10 +192,16 @@ renderer::control::Control createRenderControl(graphics::Device& graphicsDevice,
 
 } // anonymous namespace
 
-ImGuiHost::ImGuiHost(time::Timer timer, graphics::Device& graphicsDevice, size_t width, size_t height) :
+ImGuiHost::ImGuiHost(
+	time::Timer timer,
+	graphics::Device& graphicsDevice,
+	renderer::shader::TechniqueCompiler& techniqueCompiler,
+	size_t width,
+	size_t height
+	) :
 	timer_(std::move(timer)),
 	constantBuffer_(createImguiConstantBuffer(graphicsDevice, width, height)),
-	technique_(createImguiTechnique(graphicsDevice)),
+	technique_(createImguiTechnique(techniqueCompiler)),
 	renderControl_(createRenderControl(graphicsDevice, width, height))
 {
 	auto& imguiIO = ImGui::GetIO();
@@ -259,7 +249,6 @@ void ImGuiHost::render(
 	ImGui::Render();
 
 	const auto& imguiDrawData = *ImGui::GetDrawData();
-	auto cmdIdx = size_t(0);
 
 	populateBuffers_(graphicsDevice, imguiDrawData);
 
@@ -272,8 +261,7 @@ void ImGuiHost::render(
 			} else {
 				const auto fontAtlas = *static_cast<const renderer::control::ResourceView*>(cmd.TextureId);
 
-				auto& drawCommand =
-					rendererCommandBuffer.create(renderer::command::CommandBuffer::CommandId{ this, cmdIdx++ });
+				auto& drawCommand = rendererCommandBuffer.create();
 
 				drawCommand.setVertexBuffer(vertexBuffer_, vertexCount_, sizeof(ImDrawVert));
 				drawCommand.setIndexBuffer(indexBuffer_, indexCount_, sizeof(ImDrawIdx));
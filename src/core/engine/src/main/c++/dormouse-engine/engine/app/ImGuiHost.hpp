@@ -3,6 +3,7 @@
 
 #include "dormouse-engine/graphics/Device.hpp"
 #include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/renderer/shader/TechniqueCompiler.hpp"
 #include "dormouse-engine/renderer/shader/Technique.hpp"
 #include "dormouse-engine/renderer/control/ResourceView.hpp"
 #include "dormouse-engine/renderer/control/Control.hpp"
@@ -17,7 +18,13 @@ namespace dormouse_engine::engine::app {
 class ImGuiHost final {
 public:
 
-	ImGuiHost(time::Timer timer, graphics::Device& graphicsDevice, size_t width, size_t height);
+	ImGuiHost(
+		time::Timer timer,
+		graphics::Device& graphicsDevice,
+		renderer::shader::TechniqueCompiler& techniqueCompiler,
+		size_t width,
+		size_t height
+		);
 
 	void update();
 
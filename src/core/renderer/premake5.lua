@@ -1,11 +1,24 @@
 structure.library_project("renderer", function()
 		links { "essentials", "graphics", "math" }
+		link_boost_libs { "filesystem" }
 		includedirs { ponder_include_dir() };
 	end
 	)
 
+-- With the null graphics backend the tests and benchmarks stay console applications, tester then
+-- creates a headless device instead of a window
 project "renderer-unit-test"
-	kind "WindowedApp"
-	flags { "WinMain" }
+	if GRAPHICS_API ~= "null" then
+		kind "WindowedApp"
+		flags { "WinMain" }
+	end
+	links { "tester" }
+project "*"
+
+project "renderer-benchmark"
+	if GRAPHICS_API ~= "null" then
+		kind "WindowedApp"
+		flags { "WinMain" }
+	end
 	links { "tester" }
 project "*"
@@ -0,0 +1,109 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include "dormouse-engine/essentials/Range.hpp"
+#include "dormouse-engine/essentials/test-utils/Benchmark.hpp"
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/command/CommandKey.hpp"
+#include "dormouse-engine/renderer/control/Control.hpp"
+#include "dormouse-engine/renderer/control/RenderState.hpp"
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+
+namespace /* anonymous */ {
+
+const auto COMMAND_COUNT = size_t(20000);
+
+const auto FRAME_COUNT = size_t(50);
+
+const auto MATERIAL_COUNT = size_t(64);
+
+class CommandBufferBenchmarkFixture : public tester::RenderingFixture {
+public:
+
+	void record(command::DrawCommand& cmd, size_t idx) const {
+		auto commandKey = renderControl_.commandKey();
+		commandKey.setMaterialId(static_cast<command::MaterialId>(idx % MATERIAL_COUNT));
+
+		cmd.setRenderControl(control::Control(
+			commandKey,
+			renderControl_.depthStencil(),
+			renderControl_.renderTarget(),
+			renderControl_.viewport(),
+			renderControl_.renderState()
+			));
+		cmd.setTechnique(essentials::make_observer(&technique_));
+		cmd.setVertexBuffer(graphics::Buffer(), 0u, 0u);
+		cmd.setIndexBuffer(graphics::Buffer(), 0u, 2u);
+		cmd.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+	}
+
+	graphics::CommandList& commandList() {
+		return graphicsDevice().getImmediateCommandList();
+	}
+
+private:
+
+	shader::Technique technique_;
+
+	control::Control renderControl_ = control::Control(
+		command::CommandKey(
+			command::FullscreenLayerId::HUD,
+			command::ViewportId::FULLSCREEN,
+			command::ViewportLayer::HUD,
+			command::TranslucencyType::OPAQUE,
+			0,
+			0
+			),
+		graphicsDevice().depthStencil(),
+		graphicsDevice().backBuffer(),
+		fullscreenViewport(),
+		control::RenderState(graphicsDevice(), control::RenderState::OPAQUE)
+		);
+
+};
+
+BOOST_FIXTURE_TEST_SUITE(CommandBufferBenchmarkSuite, CommandBufferBenchmarkFixture);
+
+BOOST_AUTO_TEST_CASE(PooledCommandsWithStableIds) {
+	auto commandBuffer = command::CommandBuffer();
+
+	essentials::test_utils::benchmark("CommandBuffer pooled, stable ids", FRAME_COUNT, [&]() {
+			for (const auto idx : essentials::IndexRange(0u, COMMAND_COUNT)) {
+				record(commandBuffer.create(command::CommandBuffer::CommandId{ this, idx }), idx);
+			}
+			commandBuffer.submit(commandList());
+		});
+}
+
+BOOST_AUTO_TEST_CASE(PooledCommandsWithChangingIds) {
+	auto commandBuffer = command::CommandBuffer();
+	auto frameIdx = size_t(0);
+
+	essentials::test_utils::benchmark("CommandBuffer pooled, changing ids", FRAME_COUNT, [&]() {
+			for (const auto idx : essentials::IndexRange(0u, COMMAND_COUNT)) {
+				const auto commandId = command::CommandBuffer::CommandId{ this, frameIdx * COMMAND_COUNT + idx };
+				record(commandBuffer.create(commandId), idx);
+			}
+			commandBuffer.submit(commandList());
+			++frameIdx;
+		});
+}
+
+BOOST_AUTO_TEST_CASE(FrameArenaCommands) {
+	auto commandBuffer = command::CommandBuffer();
+
+	essentials::test_utils::benchmark("CommandBuffer frame arena", FRAME_COUNT, [&]() {
+			for (const auto idx : essentials::IndexRange(0u, COMMAND_COUNT)) {
+				record(commandBuffer.create(), idx);
+			}
+			commandBuffer.submit(commandList());
+		});
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* CommandBufferBenchmarkSuite */);
+
+} // anonymous namespace
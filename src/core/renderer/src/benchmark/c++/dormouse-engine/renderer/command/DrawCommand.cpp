@@ -0,0 +1,188 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "dormouse-engine/essentials/Range.hpp"
+#include "dormouse-engine/essentials/test-utils/Benchmark.hpp"
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/command/CommandKey.hpp"
+#include "dormouse-engine/renderer/command/ConstantUploadBuffer.hpp"
+#include "dormouse-engine/renderer/command/DrawCommand.hpp"
+#include "dormouse-engine/renderer/control/Control.hpp"
+#include "dormouse-engine/renderer/control/RenderState.hpp"
+#include "dormouse-engine/renderer/control/Sampler.hpp"
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+
+namespace /* anonymous */ {
+
+const auto FRAME_COUNT = size_t(20);
+
+const auto MATERIAL_COUNT = size_t(64);
+
+const auto CONSTANT_DATA_SIZE = size_t(64);
+
+const auto INSTANCE_CAPACITY = size_t(1024);
+
+graphics::Buffer createInstanceBuffer(graphics::Device& graphicsDevice) {
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::VERTEX_BUFFER;
+	configuration.size = INSTANCE_CAPACITY * CONSTANT_DATA_SIZE;
+	return graphics::Buffer(graphicsDevice, configuration);
+}
+
+graphics::Buffer createConstantBuffer(graphics::Device& graphicsDevice) {
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::CONSTANT_BUFFER;
+	configuration.size = CONSTANT_DATA_SIZE;
+	return graphics::Buffer(graphicsDevice, configuration);
+}
+
+class DrawCommandBenchmarkFixture : public tester::RenderingFixture {
+public:
+
+	// Records a command with the bindings of a typical textured draw: a sampler, a resource and a constant
+	// buffer with per-object data. Instanced commands pass the per-object data as instance data instead,
+	// like sprites do.
+	void record(command::CommandBuffer& commandBuffer, size_t idx, bool instanced) const {
+		auto& cmd = commandBuffer.create();
+
+		auto commandKey = renderControl_.commandKey();
+		commandKey.setMaterialId(static_cast<command::MaterialId>(idx % MATERIAL_COUNT));
+
+		cmd.setRenderControl(control::Control(
+			commandKey,
+			renderControl_.depthStencil(),
+			renderControl_.renderTarget(),
+			renderControl_.viewport(),
+			renderControl_.renderState()
+			));
+		cmd.setTechnique(essentials::make_observer(&technique_));
+		cmd.setSampler(sampler_, graphics::ShaderType::PIXEL, 0u);
+		cmd.setResource(control::ResourceView(), graphics::ShaderType::PIXEL, 0u);
+		cmd.setVertexBuffer(graphics::Buffer(), 4u, 0u);
+		cmd.setIndexBuffer(graphics::Buffer(), 4u, 2u);
+		cmd.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+
+		if (instanced) {
+			cmd.setInstanceBuffer(instanceBuffer_, INSTANCE_CAPACITY, CONSTANT_DATA_SIZE);
+			cmd.allocateInstanceData();
+		} else {
+			cmd.setConstantBuffer(constantBuffer_, graphics::ShaderType::VERTEX, 0u);
+			cmd.allocateConstantBufferData(graphics::ShaderType::VERTEX, 0u, CONSTANT_DATA_SIZE);
+		}
+	}
+
+	void reportFootprint(size_t commandCount) const {
+		// the bindings set by record fit in the inline binding tables, so they're part of the command
+		const auto commandBytes = sizeof(command::DrawCommand);
+
+		std::cout
+			<< "DrawCommand footprint (" << commandCount << " commands) - "
+			<< "command with bindings: " << commandBytes << "B, "
+			<< "constant data: " << CONSTANT_DATA_SIZE << "B, "
+			<< "total: " << (commandCount * (commandBytes + CONSTANT_DATA_SIZE)) / 1024u << "KiB"
+			<< std::endl;
+	}
+
+	// With staged set, constant data is written through a ConstantUploadBuffer with one lock per frame.
+	void benchmarkSubmit(size_t commandCount, bool instanced = false, bool staged = false) {
+		auto commandBuffer = command::CommandBuffer();
+		auto uploadBuffer = command::ConstantUploadBuffer(graphicsDevice());
+
+		if (staged) {
+			commandBuffer.setConstantUploadBuffer(essentials::make_observer(&uploadBuffer));
+		}
+
+		reportFootprint(commandCount);
+
+		const auto description =
+			std::to_string(commandCount) + (instanced ? " instanced commands" : " commands") +
+			(staged ? " with upload buffer" : "");
+
+		essentials::test_utils::benchmark(
+			"DrawCommand submit, " + description,
+			FRAME_COUNT,
+			[&]() {
+				for (const auto idx : essentials::IndexRange(0u, commandCount)) {
+					record(commandBuffer, idx, instanced);
+				}
+				commandBuffer.sort();
+			},
+			[&]() {
+				commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+			});
+
+		const auto& statistics = commandBuffer.lastFrameStatistics();
+		std::cout
+			<< "DrawCommand state changes (" << description << ") - "
+			<< "binds: " << statistics.binds << ", elided: " << statistics.elidedBinds << ", "
+			<< "uploads: " << statistics.uploads << ", elided: " << statistics.elidedUploads << ", "
+			<< "uploaded: " << statistics.uploadedBytes / 1024u << "KiB, "
+			<< "draws: " << statistics.draws << ", instanced: " << statistics.instancedDraws
+			<< std::endl;
+	}
+
+private:
+
+	shader::Technique technique_;
+
+	control::Sampler sampler_ = control::Sampler(graphicsDevice(), control::Sampler::WRAPPED_LINEAR);
+
+	graphics::Buffer constantBuffer_ = createConstantBuffer(graphicsDevice());
+
+	graphics::Buffer instanceBuffer_ = createInstanceBuffer(graphicsDevice());
+
+	control::Control renderControl_ = control::Control(
+		command::CommandKey(
+			command::FullscreenLayerId::GAME,
+			command::ViewportId::FULLSCREEN,
+			command::ViewportLayer::WORLD,
+			command::TranslucencyType::OPAQUE,
+			0,
+			0
+			),
+		graphicsDevice().depthStencil(),
+		graphicsDevice().backBuffer(),
+		fullscreenViewport(),
+		control::RenderState(graphicsDevice(), control::RenderState::OPAQUE)
+		);
+
+};
+
+BOOST_FIXTURE_TEST_SUITE(DrawCommandBenchmarkSuite, DrawCommandBenchmarkFixture);
+
+BOOST_AUTO_TEST_CASE(Submit10kCommands) {
+	benchmarkSubmit(10000u);
+}
+
+BOOST_AUTO_TEST_CASE(Submit100kCommands) {
+	benchmarkSubmit(100000u);
+}
+
+BOOST_AUTO_TEST_CASE(Submit10kInstancedCommands) {
+	benchmarkSubmit(10000u, true);
+}
+
+BOOST_AUTO_TEST_CASE(Submit10kCommandsWithUploadBuffer) {
+	benchmarkSubmit(10000u, false, true);
+}
+
+BOOST_AUTO_TEST_CASE(Submit100kCommandsWithUploadBuffer) {
+	benchmarkSubmit(100000u, false, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* DrawCommandBenchmarkSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,2 @@
+#define DE_TEST_MODULE "dormouse_engine::renderer::benchmark"
+#include "dormouse-engine/tester/main.hpp"
@@ -1,7 +1,7 @@
 #ifndef _DORMOUSEENGINE_RENDERER_COMMAND_COMMAND_HPP_
 #define _DORMOUSEENGINE_RENDERER_COMMAND_COMMAND_HPP_
 
-#include "dormouse-engine/graphics/CommandList.hpp"
+#include "commandfwd.hpp"
 #include "CommandKey.hpp"
 
 namespace dormouse_engine::renderer::command {
@@ -13,7 +13,8 @@ public:
 
 	virtual CommandKey key() const = 0;
 
-	virtual void submit(graphics::CommandList& commandList, const Command* previous) const = 0;
+	// Submits the command through stateCache, which skips state already bound by previous commands.
+	virtual void submit(StateCache& stateCache) const = 0;
 
 };
 
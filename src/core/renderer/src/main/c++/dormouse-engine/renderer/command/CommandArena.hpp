@@ -0,0 +1,64 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDARENA_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDARENA_HPP_
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace dormouse_engine::renderer::command {
+
+// Frame-scoped storage for commands. Commands are stored contiguously in fixed-size blocks, so
+// references stay valid while the arena grows. reset() only rewinds the cursor - the blocks, and any
+// memory owned by the commands themselves, are kept for re-use in the next frame. CommandType::reset()
+// is called on a command when it is handed out again.
+template <class CommandType, size_t BLOCK_SIZE = 64u>
+class CommandArena final {
+public:
+
+	CommandType& allocate() {
+		const auto blockIdx = size_ / BLOCK_SIZE;
+		const auto elementIdx = size_ % BLOCK_SIZE;
+
+		if (blockIdx == blocks_.size()) {
+			blocks_.emplace_back(std::make_unique<Block>());
+		}
+
+		++size_;
+
+		auto& command = (*blocks_[blockIdx])[elementIdx];
+		if (size_ <= highWaterMark_) {
+			command.reset();
+		} else {
+			highWaterMark_ = size_;
+		}
+
+		return command;
+	}
+
+	void reset() noexcept {
+		size_ = 0u;
+	}
+
+	size_t size() const noexcept {
+		return size_;
+	}
+
+	size_t capacity() const noexcept {
+		return blocks_.size() * BLOCK_SIZE;
+	}
+
+private:
+
+	using Block = std::array<CommandType, BLOCK_SIZE>;
+
+	std::vector<std::unique_ptr<Block>> blocks_;
+
+	size_t size_ = 0u;
+
+	size_t highWaterMark_ = 0u;
+
+};
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDARENA_HPP_ */
@@ -1,58 +1,119 @@
 #include "CommandBuffer.hpp"
 
-#include <algorithm>
+#include "dormouse-engine/essentials/radix-sort.hpp"
 
 using namespace dormouse_engine;
 using namespace dormouse_engine::renderer::command;
 
+DrawCommand& CommandBuffer::create() {
+	sorted_ = false;
+	auto& command = drawCommandArena_.allocate();
+	command.setConstantDataArena(essentials::make_observer(&constantDataArena_));
+	command.setVertexDataArena(essentials::make_observer(&vertexDataArena_));
+	commands_.emplace_back(&command);
+	return command;
+}
+
 DrawCommand& CommandBuffer::create(const CommandId& commandId) {
-	auto it = drawCommandPoolIndex_.find(commandId);
+	sorted_ = false;
 
+	auto it = drawCommandPoolIndex_.find(commandId);
 	if (it != drawCommandPoolIndex_.end()) {
-		it->second.lastFrameUsed = lastFrameIdx_ + 1;
-		commands_.emplace_back(it->second.poolIndex);
-		return drawCommandPool_[it->second.poolIndex];
-	} else {
-		// TODO: could be done much more efficiently, so this is temp, right?
-		// TODO: also, potentially the pooling could be done by an external class for separation of concerns
-		// especially with other caches coming in the future (e.g. filesystem)
-		for (auto& indexEntry : drawCommandPoolIndex_) {
-			if (indexEntry.second.lastFrameUsed < lastFrameIdx_) {
-				const auto poolIndex = indexEntry.second.poolIndex;
-				drawCommandPoolIndex_.erase(indexEntry.first);
-				drawCommandPoolIndex_.emplace(
-					commandId, DrawCommandPoolIndexEntry{ poolIndex, lastFrameIdx_ + 1 });
-				commands_.emplace_back(poolIndex);
-				return drawCommandPool_[poolIndex];
-			}
-		}
-
-		drawCommandPool_.emplace_back();
-		const auto poolIndex = drawCommandPool_.size() - 1;
-		drawCommandPoolIndex_.emplace(
-			commandId, DrawCommandPoolIndexEntry{ poolIndex, lastFrameIdx_ + 1 });
-		commands_.emplace_back(poolIndex);
-		return drawCommandPool_.back();
+		return usePooled_(drawCommandPool_[it->second]);
+	}
+
+	const auto handle = drawCommandPool_.emplace(PooledDrawCommand{ DrawCommand(), commandId, 0u });
+	drawCommandPoolIndex_.emplace(commandId, handle);
+	return usePooled_(drawCommandPool_[handle]);
+}
+
+void CommandBuffer::sort() {
+	if (sorted_) {
+		return;
 	}
+
+	sortedCommands_.clear();
+	sortedCommands_.reserve(commands_.size());
+	for (const auto* command : commands_) {
+		sortedCommands_.emplace_back(SortEntry{ command->key().hash(), command });
+	}
+
+	essentials::radixSort(sortedCommands_, sortBuffer_, [](const SortEntry& entry) { return entry.key; });
+
+	sorted_ = true;
 }
 
 void CommandBuffer::submit(dormouse_engine::graphics::CommandList& commandList) {
-	std::sort(commands_.begin(), commands_.end(), [this](const auto lhs, const auto rhs) {
-			return drawCommandPool_[lhs].key().hash() < drawCommandPool_[rhs].key().hash();
-		});
+	sort();
 
-	const auto* previousCommand = static_cast<const Command*>(nullptr);
+	if (!stateCache_ || &stateCache_->commandList() != &commandList) {
+		stateCache_ = std::make_unique<StateCache>(commandList);
+	}
+
+	auto& stateCache = *stateCache_;
+	stateCache.beginFrame();
+
+	if (constantUploadBuffer_) {
+		constantUploadBuffer_->reset();
+		constantUploadBuffer_->stage(constantDataArena_);
+		stateCache.uploadStagedConstantData(*constantUploadBuffer_);
+	}
 
-	for (const auto poolIdx : commands_) {
-		const auto command = &drawCommandPool_[poolIdx];
-		command->submit(commandList, previousCommand);
-		previousCommand = command;
+	for (const auto& entry : sortedCommands_) {
+		instanceBatcher_.submit(stateCache, *entry.command);
 	}
+	instanceBatcher_.flush(stateCache);
 
+	lastFrameStatistics_ = stateCache.statistics();
+
+	clear();
+}
+
+void CommandBuffer::invalidateState() {
+	if (stateCache_) {
+		stateCache_->invalidate();
+	}
+}
+
+void CommandBuffer::clear() {
 	commands_.clear();
+	sortedCommands_.clear();
+	drawCommandArena_.reset();
+	constantDataArena_.reset();
+	vertexDataArena_.reset();
+	sorted_ = true;
+	evictPooled_();
 	++lastFrameIdx_;
 }
 
+DrawCommand& CommandBuffer::usePooled_(PooledDrawCommand& pooled) {
+	pooled.lastFrameUsed = lastFrameIdx_ + 1;
+
+	auto& command = pooled.command;
+
+	// constant data of the previous frame is gone with the arena reset
+	command.resetConstantBufferData();
+	command.setConstantDataArena(essentials::make_observer(&constantDataArena_));
+	command.setVertexDataArena(essentials::make_observer(&vertexDataArena_));
+	commands_.emplace_back(&command);
+	return command;
+}
+
+void CommandBuffer::evictPooled_() {
+	if (drawCommandPool_.empty()) {
+		return;
+	}
+
+	drawCommandPool_.eraseIf([this](const PooledDrawCommand& pooled) {
+			if (pooled.lastFrameUsed < lastFrameIdx_) {
+				drawCommandPoolIndex_.erase(pooled.commandId);
+				return true;
+			}
+
+			return false;
+		});
+}
+
 size_t CommandBuffer::CommandIdHash::operator()(const CommandId& commandId) const noexcept {
 	auto hash = size_t();
 	hash = essentials::hashCombine(hash, std::hash_value(commandId.object));
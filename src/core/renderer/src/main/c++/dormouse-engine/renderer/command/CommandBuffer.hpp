@@ -1,14 +1,21 @@
 #ifndef _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDBUFFER_HPP_
 #define _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDBUFFER_HPP_
 
+#include <cstdint>
+#include <memory>
 #include <vector>
-#include <deque>
 #include <unordered_map>
 
 #include "dormouse-engine/essentials/observer_ptr.hpp"
 #include "dormouse-engine/essentials/hash-combine.hpp"
+#include "dormouse-engine/essentials/Pool.hpp"
 #include "dormouse-engine/graphics/CommandList.hpp"
+#include "CommandArena.hpp"
+#include "ConstantDataArena.hpp"
+#include "ConstantUploadBuffer.hpp"
 #include "DrawCommand.hpp"
+#include "InstanceBatcher.hpp"
+#include "StateCache.hpp"
 
 namespace dormouse_engine::renderer::command {
 
@@ -20,18 +27,67 @@ public:
 		size_t idx;
 	};
 
+	// Keys are extracted once per frame, so that sorting doesn't need to chase command pointers.
+	struct SortEntry {
+		std::uint64_t key;
+		const DrawCommand* command;
+	};
+
+	using SortEntries = std::vector<SortEntry>;
+
+	// Allocates a command from the frame arena. The command is valid until the end of the next submit
+	// call and is in its default state, so everything it needs must be set every frame.
+	DrawCommand& create();
+
 	// TODO: separate create and add?
+	// Returns a pooled command, re-using the one created for commandId in the previous frame if possible.
+	// Pooled commands not used in the frame being cleared nor in the one before are dropped by clear.
 	DrawCommand& create(const CommandId& commandId);
 
+	size_t pooledCommandCount() const noexcept {
+		return drawCommandPool_.size();
+	}
+
+	// Sorts the commands recorded so far. Called by submit if needed, but may be called by the recording
+	// thread once it's done, so that multiple buffers are sorted in parallel.
+	void sort();
+
+	// Sorted commands. Valid after a call to sort, until the next call to create or clear.
+	const SortEntries& sortedCommands() const noexcept {
+		return sortedCommands_;
+	}
+
+	// If set, constant data of all commands is written to uploadBuffer with a single lock per submit
+	// instead of being uploaded command by command.
+	void setConstantUploadBuffer(essentials::observer_ptr<ConstantUploadBuffer> uploadBuffer) {
+		constantUploadBuffer_ = std::move(uploadBuffer);
+	}
+
+	const ConstantDataArena& constantDataArena() const noexcept {
+		return constantDataArena_;
+	}
+
+	// Consecutive compatible instanced commands are drawn with a single instanced draw call.
+	// The state bound is tracked between submits to the same command list, see invalidateState.
 	void submit(dormouse_engine::graphics::CommandList& commandList);
 
+	// Forgets the state bound by previous submits, to be called if state was bound through the command list
+	// other than by this buffer.
+	void invalidateState();
+
+	// Binds, uploads and draws of the last submit, including the ones elided by the state cache.
+	const StateCache::Statistics& lastFrameStatistics() const noexcept {
+		return lastFrameStatistics_;
+	}
+
+	// Drops all recorded commands and pooled commands gone unused, and starts a new frame.
+	void clear();
+
 private:
 
-	// TODO: does this pooling strategy make any sense? Might as well just create
-	// the commands every frame. There's probably no use in re-using them and it complicates
-	// the logic.
-	struct DrawCommandPoolIndexEntry {
-		size_t poolIndex;
+	struct PooledDrawCommand {
+		DrawCommand command;
+		CommandId commandId;
 		size_t lastFrameUsed;
 	};
 
@@ -43,21 +99,50 @@ private:
 		bool operator()(const CommandId& lhs, const CommandId& rhs) const noexcept;
 	};
 
-	using Commands = std::vector<size_t>;
+	using Commands = std::vector<const DrawCommand*>;
+
+	using DrawCommandArena = CommandArena<DrawCommand>;
 
-	using DrawCommandPool = std::deque<DrawCommand>;
+	using DrawCommandPool = essentials::Pool<PooledDrawCommand>;
 
 	using DrawCommandPoolIndex =
-		std::unordered_map<CommandId, DrawCommandPoolIndexEntry, CommandIdHash, CommandIdEqual>;
+		std::unordered_map<CommandId, DrawCommandPool::Handle, CommandIdHash, CommandIdEqual>;
 
 	Commands commands_;
 
+	SortEntries sortedCommands_;
+
+	SortEntries sortBuffer_;
+
+	DrawCommandArena drawCommandArena_;
+
+	ConstantDataArena constantDataArena_;
+
+	// Vertex and instance data, kept apart so that staging constantDataArena_ doesn't copy them
+	ConstantDataArena vertexDataArena_;
+
+	essentials::observer_ptr<ConstantUploadBuffer> constantUploadBuffer_;
+
 	DrawCommandPool drawCommandPool_;
 
 	DrawCommandPoolIndex drawCommandPoolIndex_;
 
 	size_t lastFrameIdx_ = 0;
 
+	bool sorted_ = true;
+
+	InstanceBatcher instanceBatcher_;
+
+	// Cache of the command list last submitted to
+	std::unique_ptr<StateCache> stateCache_;
+
+	StateCache::Statistics lastFrameStatistics_;
+
+	DrawCommand& usePooled_(PooledDrawCommand& pooled);
+
+	// Erases pooled commands not used in this or the previous frame, along with their index entries
+	void evictPooled_();
+
 };
 
 } // namespace dormouse_engine::renderer::command
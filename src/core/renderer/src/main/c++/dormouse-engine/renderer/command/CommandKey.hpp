@@ -1,9 +1,15 @@
 #ifndef _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDKEY_HPP_
 #define _DORMOUSEENGINE_RENDERER_COMMAND_COMMANDKEY_HPP_
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <functional>
+#include <stdexcept>
 #include <type_traits>
 
+#include "commandfwd.hpp"
+
 namespace dormouse_engine::renderer::command {
 
 enum class FullscreenLayerId {
@@ -39,97 +45,242 @@ constexpr auto DEPTH_BITS = 24u;
 using MaterialId = std::uint32_t;
 constexpr auto MATERIAL_ID_BITS = 32u;
 
-class CommandKey final {
+// Describes how the fields of a command key are packed into a 64-bit integer. Fields are listed from the
+// most to the least significant, so the order of the list is the sort order of the commands.
+class CommandKeyLayout final {
 public:
 
-	constexpr CommandKey() = default;
+	enum class Field {
+		FULLSCREEN_LAYER_ID,
+		VIEWPORT_ID,
+		VIEWPORT_LAYER,
+		TRANSLUCENCY_TYPE,
+		DEPTH,
+		MATERIAL_ID,
+	};
+
+	static constexpr auto FIELD_COUNT = size_t(6);
+
+	struct FieldBits {
+		Field field;
+		unsigned int bits;
+	};
+
+	using Fields = std::array<FieldBits, FIELD_COUNT>;
+
+	// If flipTranslucentDepth is set, depth of translucent commands is stored inverted, so that they are
+	// sorted back-to-front, while opaque commands are sorted front-to-back.
+	constexpr CommandKeyLayout(const Fields& fields, bool flipTranslucentDepth) :
+		flipTranslucentDepth_(flipTranslucentDepth)
+	{
+		auto used = std::array<bool, FIELD_COUNT>();
+		auto shift = 64u;
+
+		for (const auto& fieldBits : fields) {
+			const auto fieldIdx = static_cast<size_t>(fieldBits.field);
+
+			if (used[fieldIdx]) {
+				throw std::logic_error("Command key field listed more than once");
+			}
+			if (fieldBits.bits == 0u || fieldBits.bits > shift) {
+				throw std::logic_error("Command key fields don't fit in 64 bits");
+			}
+
+			used[fieldIdx] = true;
+			shift -= fieldBits.bits;
+			bits_[fieldIdx] = fieldBits.bits;
+			shifts_[fieldIdx] = shift;
+		}
+	}
+
+	constexpr unsigned int bits(Field field) const noexcept {
+		return bits_[static_cast<size_t>(field)];
+	}
+
+	constexpr unsigned int shift(Field field) const noexcept {
+		return shifts_[static_cast<size_t>(field)];
+	}
+
+	constexpr std::uint64_t mask(Field field) const noexcept {
+		return bits(field) == 64u ? ~std::uint64_t(0) : ((std::uint64_t(1) << bits(field)) - 1u);
+	}
+
+	constexpr std::uint64_t encode(Field field, std::uint64_t value) const noexcept {
+		return (value & mask(field)) << shift(field);
+	}
+
+	constexpr std::uint64_t decode(Field field, std::uint64_t key) const noexcept {
+		return (key >> shift(field)) & mask(field);
+	}
+
+	constexpr std::uint64_t replace(Field field, std::uint64_t key, std::uint64_t value) const noexcept {
+		return (key & ~(mask(field) << shift(field))) | encode(field, value);
+	}
+
+	constexpr bool flipTranslucentDepth() const noexcept {
+		return flipTranslucentDepth_;
+	}
+
+private:
+
+	std::array<unsigned int, FIELD_COUNT> bits_ = {};
+
+	std::array<unsigned int, FIELD_COUNT> shifts_ = {};
 
-	constexpr CommandKey(
+	bool flipTranslucentDepth_;
+
+};
+
+struct DefaultCommandKeyLayout {
+
+	static constexpr auto LAYOUT = CommandKeyLayout(
+		{{
+			{ CommandKeyLayout::Field::FULLSCREEN_LAYER_ID, FULLSCREEN_LAYER_BITS },
+			{ CommandKeyLayout::Field::VIEWPORT_ID, VIEWPORT_ID_BITS },
+			{ CommandKeyLayout::Field::VIEWPORT_LAYER, VIEWPORT_LAYER_BITS },
+			{ CommandKeyLayout::Field::TRANSLUCENCY_TYPE, TRANSLUCENCY_TYPE_BITS },
+			{ CommandKeyLayout::Field::DEPTH, DEPTH_BITS },
+			{ CommandKeyLayout::Field::MATERIAL_ID, MATERIAL_ID_BITS },
+		}},
+		true
+		);
+
+};
+
+// Sort key of a command, stored as a single integer with fields packed according to LayoutType::LAYOUT.
+// Keys compare as plain integers, so the encoding is the same for every compiler and platform.
+template <class LayoutType>
+class BasicCommandKey final {
+public:
+
+	using Field = CommandKeyLayout::Field;
+
+	static constexpr const CommandKeyLayout& LAYOUT = LayoutType::LAYOUT;
+
+	constexpr BasicCommandKey() noexcept :
+		BasicCommandKey(
+			static_cast<FullscreenLayerId>(0),
+			static_cast<ViewportId>(0),
+			static_cast<ViewportLayer>(0),
+			static_cast<TranslucencyType>(0),
+			0,
+			0
+			)
+	{
+	}
+
+	constexpr BasicCommandKey(
 		FullscreenLayerId fullscreenLayerId,
 		ViewportId viewportId,
 		ViewportLayer viewportLayer,
 		TranslucencyType translucencyType,
 		Depth depth,
 		MaterialId materialId
-		) noexcept :
-		data_(fullscreenLayerId, viewportId, viewportLayer, translucencyType, depth, materialId)
+		) noexcept
 	{
+		setFullscreenLayerId(fullscreenLayerId);
+		setViewportId(viewportId);
+		setViewportLayer(viewportLayer);
+		setTranslucencyType(translucencyType);
+		setDepth(depth);
+		setMaterialId(materialId);
+	}
+
+	[[nodiscard]] constexpr std::uint64_t hash() const noexcept {
+		return hash_;
 	}
 
-	[[nodiscard]] const std::uint64_t hash() const noexcept {
-		return reinterpret_cast<const std::uint64_t&>(data_);
+	constexpr FullscreenLayerId fullscreenLayerId() const noexcept {
+		return static_cast<FullscreenLayerId>(LAYOUT.decode(Field::FULLSCREEN_LAYER_ID, hash_));
 	}
 
 	constexpr void setFullscreenLayerId(FullscreenLayerId fullscreenLayerId) noexcept {
-		data_.fullscreenLayerId = fullscreenLayerId;
+		set_(Field::FULLSCREEN_LAYER_ID, static_cast<std::uint64_t>(fullscreenLayerId));
+	}
+
+	constexpr ViewportId viewportId() const noexcept {
+		return static_cast<ViewportId>(LAYOUT.decode(Field::VIEWPORT_ID, hash_));
 	}
 
 	constexpr void setViewportId(ViewportId viewportId) noexcept {
-		data_.viewportId = viewportId;
+		set_(Field::VIEWPORT_ID, static_cast<std::uint64_t>(viewportId));
+	}
+
+	constexpr ViewportLayer viewportLayer() const noexcept {
+		return static_cast<ViewportLayer>(LAYOUT.decode(Field::VIEWPORT_LAYER, hash_));
 	}
 
 	constexpr void setViewportLayer(ViewportLayer viewportLayer) noexcept {
-		data_.viewportLayer = viewportLayer;
+		set_(Field::VIEWPORT_LAYER, static_cast<std::uint64_t>(viewportLayer));
+	}
+
+	constexpr TranslucencyType translucencyType() const noexcept {
+		return static_cast<TranslucencyType>(LAYOUT.decode(Field::TRANSLUCENCY_TYPE, hash_));
 	}
 
 	constexpr void setTranslucencyType(TranslucencyType translucencyType) noexcept {
-		data_.translucencyType = translucencyType;
+		const auto depth = this->depth();
+		set_(Field::TRANSLUCENCY_TYPE, static_cast<std::uint64_t>(translucencyType));
+		setDepth(depth);
+	}
+
+	constexpr Depth depth() const noexcept {
+		auto biased = LAYOUT.decode(Field::DEPTH, hash_);
+		if (depthFlipped_()) {
+			biased ^= LAYOUT.mask(Field::DEPTH);
+		}
+		return static_cast<Depth>(static_cast<std::int64_t>(biased) - depthBias_());
 	}
 
+	// Depth is clamped to the range representable in the layout's depth bits.
 	constexpr void setDepth(Depth depth) noexcept {
-		data_.depth = depth;
+		const auto minDepth = -depthBias_();
+		const auto maxDepth = static_cast<std::int64_t>(LAYOUT.mask(Field::DEPTH)) - depthBias_();
+		const auto clamped = std::min(std::max(static_cast<std::int64_t>(depth), minDepth), maxDepth);
+
+		auto biased = static_cast<std::uint64_t>(clamped + depthBias_());
+		if (depthFlipped_()) {
+			biased ^= LAYOUT.mask(Field::DEPTH);
+		}
+
+		set_(Field::DEPTH, biased);
+	}
+
+	constexpr MaterialId materialId() const noexcept {
+		return static_cast<MaterialId>(LAYOUT.decode(Field::MATERIAL_ID, hash_));
 	}
 
 	constexpr void setMaterialId(MaterialId materialId) noexcept {
-		data_.materialId = materialId;
+		set_(Field::MATERIAL_ID, static_cast<std::uint64_t>(materialId));
 	}
 
 private:
 
-	struct Data {
-
-		// TODO: ordering here is reversed because visual studio orders bitfield elements from right to left
-		// but this won't work on other platforms. Find a better way.
-		MaterialId materialId : MATERIAL_ID_BITS;
-		Depth depth : DEPTH_BITS;
-		TranslucencyType translucencyType : TRANSLUCENCY_TYPE_BITS;
-		ViewportLayer viewportLayer : VIEWPORT_LAYER_BITS;
-		ViewportId viewportId : VIEWPORT_ID_BITS;
-		FullscreenLayerId fullscreenLayerId : FULLSCREEN_LAYER_BITS;
-
-		constexpr Data() noexcept :
-			Data(
-				static_cast<FullscreenLayerId>(0),
-				static_cast<ViewportId>(0),
-				static_cast<ViewportLayer>(0),
-				static_cast<TranslucencyType>(0),
-				0,
-				0
-				)
-		{
-		}
+	std::uint64_t hash_ = 0u;
 
-		constexpr Data(
-			FullscreenLayerId fullscreenLayerId,
-			ViewportId viewportId,
-			ViewportLayer viewportLayer,
-			TranslucencyType translucencyType,
-			Depth depth,
-			MaterialId materialId
-			) noexcept :
-			materialId(materialId),
-			depth(depth),
-			translucencyType(translucencyType),
-			viewportLayer(viewportLayer),
-			viewportId(viewportId),
-			fullscreenLayerId(fullscreenLayerId)
-		{
-		}
+	constexpr void set_(Field field, std::uint64_t value) noexcept {
+		hash_ = LAYOUT.replace(field, hash_, value);
+	}
 
-	} data_;
+	// Signed depth is stored with a bias, so that the unsigned representation keeps the ordering.
+	static constexpr std::int64_t depthBias_() noexcept {
+		return std::int64_t(1) << (LAYOUT.bits(Field::DEPTH) - 1u);
+	}
+
+	constexpr bool depthFlipped_() const noexcept {
+		return LAYOUT.flipTranslucentDepth() && translucencyType() == TranslucencyType::TRANSLUCENT;
+	}
+
+	friend constexpr bool operator==(const BasicCommandKey& lhs, const BasicCommandKey& rhs) noexcept {
+		return lhs.hash() == rhs.hash();
+	}
+
+	friend constexpr bool operator!=(const BasicCommandKey& lhs, const BasicCommandKey& rhs) noexcept {
+		return lhs.hash() != rhs.hash();
+	}
 
-	friend bool operator<(const CommandKey& lhs, const CommandKey& rhs) noexcept {
-		return rhs.hash() < lhs.hash();
+	friend constexpr bool operator<(const BasicCommandKey& lhs, const BasicCommandKey& rhs) noexcept {
+		return lhs.hash() < rhs.hash();
 	}
 
 };
@@ -140,11 +291,13 @@ static_assert(sizeof(CommandKey) == sizeof(std::uint64_t));
 
 namespace std {
 
-template <>
-struct hash<dormouse_engine::renderer::command::CommandKey> {
+template <class LayoutType>
+struct hash<dormouse_engine::renderer::command::BasicCommandKey<LayoutType>> {
 
-	constexpr size_t operator()(const dormouse_engine::renderer::command::CommandKey commandKey) const noexcept {
-		return commandKey.hash();
+	constexpr size_t operator()(
+		const dormouse_engine::renderer::command::BasicCommandKey<LayoutType> commandKey) const noexcept
+	{
+		return static_cast<size_t>(commandKey.hash());
 	}
 
 };
@@ -0,0 +1,71 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTDATAARENA_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTDATAARENA_HPP_
+
+#include <cassert>
+
+#include "dormouse-engine/essentials/memory.hpp"
+
+namespace dormouse_engine::renderer::command {
+
+// Frame-scoped storage for constant buffer data of all commands in a command buffer. Allocations are
+// identified by offset, because views into the arena are invalidated when it grows. reset() keeps the
+// capacity for the next frame. Offsets are relative to the start of the arena, so that its whole content
+// may be copied to a ConstantUploadBuffer at once, keeping the alignment. Command buffers keep vertex and
+// instance data in an arena of their own, which isn't staged.
+class ConstantDataArena final {
+public:
+
+	static constexpr auto ALIGNMENT = size_t(16);
+
+	struct Allocation {
+
+		size_t offset = 0u;
+
+		size_t size = 0u;
+
+	};
+
+	// Returns a zero-filled allocation of the given size. alignment must be a power of two.
+	Allocation allocate(size_t size, size_t alignment = ALIGNMENT) {
+		assert(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+		const auto offset = (data_.size() + alignment - 1u) & ~(alignment - 1u);
+		data_.resize(offset + size);
+		return Allocation{ offset, size };
+	}
+
+	essentials::BufferView view(const Allocation& allocation) {
+		assert(allocation.offset + allocation.size <= data_.size());
+		return essentials::viewBuffer(data_.data() + allocation.offset, allocation.size);
+	}
+
+	essentials::ConstBufferView view(const Allocation& allocation) const {
+		assert(allocation.offset + allocation.size <= data_.size());
+		return essentials::viewBuffer(
+			static_cast<const essentials::Byte*>(data_.data() + allocation.offset), allocation.size);
+	}
+
+	essentials::ConstBufferView data() const noexcept {
+		return essentials::viewBuffer(static_cast<const essentials::Byte*>(data_.data()), data_.size());
+	}
+
+	void reset() noexcept {
+		data_.clear();
+	}
+
+	size_t size() const noexcept {
+		return data_.size();
+	}
+
+	size_t capacity() const noexcept {
+		return data_.capacity();
+	}
+
+private:
+
+	essentials::ByteVector data_;
+
+};
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTDATAARENA_HPP_ */
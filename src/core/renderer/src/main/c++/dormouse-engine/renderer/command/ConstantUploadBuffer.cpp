@@ -0,0 +1,69 @@
+#include "ConstantUploadBuffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "../control/ConstantBuffer.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+ConstantUploadBuffer::ConstantUploadBuffer(graphics::Device& graphicsDevice, size_t capacity) :
+	graphicsDevice_(graphicsDevice)
+{
+	reserve_(capacity);
+}
+
+void ConstantUploadBuffer::reset() {
+	regions_.clear();
+	size_ = 0u;
+}
+
+void ConstantUploadBuffer::stage(const ConstantDataArena& arena) {
+	assert(!offset(arena));
+
+	const auto arenaSize = arena.size();
+	if (arenaSize == 0u) {
+		return;
+	}
+
+	// the last allocation of the arena is bound as a whole range, so it's padded up to the alignment
+	regions_.emplace_back(Region{ &arena, size_ });
+	size_ += alignUp_(arenaSize);
+}
+
+size_t ConstantUploadBuffer::upload(graphics::CommandList& commandList) {
+	if (size_ == 0u) {
+		return 0u;
+	}
+
+	if (size_ > capacity_) {
+		reserve_(std::max(size_, capacity_ * 2u));
+	}
+
+	auto locked = commandList.lock(buffer_, graphics::CommandList::LockPurpose::WRITE_DISCARD);
+	for (const auto& region : regions_) {
+		const auto data = region.arena->data();
+		std::memcpy(locked.pixels.get() + region.offset, data.data(), data.size());
+	}
+
+	return size_;
+}
+
+std::optional<size_t> ConstantUploadBuffer::offset(const ConstantDataArena& arena) const noexcept {
+	for (const auto& region : regions_) {
+		if (region.arena == &arena) {
+			return region.offset;
+		}
+	}
+
+	return std::nullopt;
+}
+
+void ConstantUploadBuffer::reserve_(size_t capacity) {
+	capacity_ = alignUp_(std::max<size_t>(capacity, 1u));
+
+	buffer_ = control::createConstantBuffer(graphicsDevice_, capacity_);
+}
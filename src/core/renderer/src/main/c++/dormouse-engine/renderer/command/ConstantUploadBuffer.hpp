@@ -0,0 +1,90 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTUPLOADBUFFER_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTUPLOADBUFFER_HPP_
+
+#include <optional>
+#include <vector>
+
+#include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/graphics/CommandList.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "ConstantDataArena.hpp"
+
+namespace dormouse_engine::renderer::command {
+
+// Device constant buffer receiving the constant data of all commands of a frame with a single lock. The
+// content of each staged ConstantDataArena is copied at a CONSTANT_BUFFER_OFFSET_ALIGNMENT-aligned offset,
+// after which commands bind ranges of this buffer instead of uploading their data one buffer at a time.
+// Constant data must be allocated with CONSTANT_BUFFER_OFFSET_ALIGNMENT, as DrawCommand does.
+// The buffer grows if the data of a frame doesn't fit.
+class ConstantUploadBuffer final {
+public:
+
+	static constexpr auto DEFAULT_CAPACITY = size_t(64 * 1024);
+
+	explicit ConstantUploadBuffer(graphics::Device& graphicsDevice, size_t capacity = DEFAULT_CAPACITY);
+
+	// Drops the arenas staged for the previous frame.
+	void reset();
+
+	// Reserves room for the current content of arena, to be written by the next call to upload. The arena
+	// must not change until the frame is submitted.
+	void stage(const ConstantDataArena& arena);
+
+	// Writes the data of all staged arenas to the buffer and returns the number of bytes written.
+	size_t upload(graphics::CommandList& commandList);
+
+	// Offset of the data of arena in the buffer, or nothing if arena wasn't staged.
+	std::optional<size_t> offset(const ConstantDataArena& arena) const noexcept;
+
+	// Size of the range to bind for an allocation of allocationSize bytes.
+	static size_t rangeSize(size_t allocationSize) noexcept {
+		return alignUp_(allocationSize);
+	}
+
+	const graphics::Buffer& buffer() const noexcept {
+		return buffer_;
+	}
+
+	size_t capacity() const noexcept {
+		return capacity_;
+	}
+
+	// Number of bytes staged for the current frame, including alignment padding.
+	size_t size() const noexcept {
+		return size_;
+	}
+
+private:
+
+	struct Region {
+
+		const ConstantDataArena* arena;
+
+		size_t offset;
+
+	};
+
+	using Regions = std::vector<Region>;
+
+	graphics::Device& graphicsDevice_;
+
+	graphics::Buffer buffer_;
+
+	size_t capacity_ = 0u;
+
+	size_t size_ = 0u;
+
+	Regions regions_;
+
+	static size_t alignUp_(size_t size) noexcept {
+		return (size + graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT - 1u) &
+			~(graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT - 1u);
+	}
+
+	void reserve_(size_t capacity);
+
+};
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_CONSTANTUPLOADBUFFER_HPP_ */
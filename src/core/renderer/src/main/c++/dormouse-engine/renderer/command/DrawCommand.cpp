@@ -1,81 +1,289 @@
 #include "DrawCommand.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #pragma warning(push, 3)
 #	include <ponder/classbuilder.hpp>
 #pragma warning(pop)
 
-#include "dormouse-engine/essentials/Range.hpp"
+#include "StateCache.hpp"
 
 using namespace dormouse_engine;
 using namespace dormouse_engine::renderer;
 using namespace dormouse_engine::renderer::command;
 
-void DrawCommand::submit(graphics::CommandList& commandList, const Command* previous) const {
-	const auto* previousCommand = dynamic_cast<const DrawCommand*>(previous);
+namespace /* anonymous */ {
 
-	if (!previousCommand || (previousCommand->control_.viewport() != control_.viewport())) {
-		commandList.setViewport(control_.viewport().get());
+template <class HandleType>
+bool sameHandle(const HandleType& lhs, const HandleType& rhs) {
+	return lhs == rhs;
+}
+
+bool sameHandle(const graphics::Buffer& lhs, const graphics::Buffer& rhs) {
+	return lhs.id() == rhs.id();
+}
+
+template <class BindingType>
+bool sameBindings(
+	const DrawCommand::BindingTable<BindingType>& lhs, const DrawCommand::BindingTable<BindingType>& rhs)
+{
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+		[](const BindingType& lhsBinding, const BindingType& rhsBinding) {
+			return
+				lhsBinding.stage == rhsBinding.stage &&
+				lhsBinding.slot == rhsBinding.slot &&
+				sameHandle(lhsBinding.handle, rhsBinding.handle);
+		});
+}
+
+bool sameData(essentials::ConstBufferView lhs, essentials::ConstBufferView rhs) {
+	return lhs.size() == rhs.size() && (lhs.size() == 0u || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+} // anonymous namespace
+
+void DrawCommand::submit(StateCache& stateCache) const {
+	if (instanced()) {
+		stateCache.uploadInstanceData(instanceBuffer_, instanceData());
+		submitInstances(stateCache, 1u);
+		return;
+	}
+
+	auto firstVertex = size_t(0);
+	if (vertexData_.size > 0u) {
+		assert(vertexCapacity_ > 0u);
+		firstVertex = stateCache.uploadVertexData(
+			vertexBuffer_, vertexCapacity_ * vertexStride_, vertexStride_, vertexData());
+	}
+
+	bind_(stateCache);
+
+	if (indexCount_ > 0u) {
+		stateCache.setIndexBuffer(indexBuffer_, indexStride_);
+		stateCache.drawIndexed(startingIndex_, indexCount_, primitiveTopology_, firstVertex);
+	} else {
+		stateCache.draw(vertexCount_, primitiveTopology_, firstVertex);
+	}
+}
+
+void DrawCommand::submitInstances(StateCache& stateCache, size_t instanceCount) const {
+	assert(instanced());
+	assert(indexCount_ > 0u);
+	assert(instanceCount <= instanceCapacity_);
+
+	bind_(stateCache);
+
+	stateCache.setInstanceBuffer(instanceBuffer_, instanceStride_);
+	stateCache.setIndexBuffer(indexBuffer_, indexStride_);
+	stateCache.drawIndexedInstanced(startingIndex_, indexCount_, instanceCount, primitiveTopology_);
+}
+
+bool DrawCommand::canBatchWith(const DrawCommand& other) const {
+	if (!instanced() || !other.instanced()) {
+		return false;
 	}
 
-	if (!previousCommand ||
-		(previousCommand->control_.renderTarget() != control_.renderTarget()) ||
-		(previousCommand->control_.depthStencil() != control_.depthStencil())
+	if (
+		pipelineState_ != other.pipelineState_ ||
+		!(control_.viewport() == other.control_.viewport()) ||
+		!(control_.renderTarget() == other.control_.renderTarget()) ||
+		!(control_.depthStencil() == other.control_.depthStencil())
 		)
 	{
-		commandList.setRenderTarget(control_.renderTarget().get(), control_.depthStencil().get());
+		return false;
 	}
 
-	if (!previousCommand || (previousCommand->control_.renderState() != control_.renderState())) {
-		commandList.setRenderState(control_.renderState().get());
+	if (
+		!sameHandle(vertexBuffer_, other.vertexBuffer_) ||
+		vertexCount_ != other.vertexCount_ ||
+		vertexStride_ != other.vertexStride_ ||
+		!sameHandle(indexBuffer_, other.indexBuffer_) ||
+		indexCount_ != other.indexCount_ ||
+		indexStride_ != other.indexStride_ ||
+		startingIndex_ != other.startingIndex_ ||
+		primitiveTopology_ != other.primitiveTopology_ ||
+		!sameHandle(instanceBuffer_, other.instanceBuffer_) ||
+		instanceStride_ != other.instanceStride_
+		)
+	{
+		return false;
 	}
 
-	for (const auto stageIdx : range<size_t>(0u, STAGE_COUNT)) {
-		const auto stage = static_cast<graphics::ShaderType>(stageIdx);
-		
-		for (const auto samplerSlotIdx : range<size_t>(0u, graphics::SAMPLER_SLOT_COUNT_PER_SHADER)) {
-			const auto sampler = sampler_(stage, samplerSlotIdx);
-			if (!previousCommand || (previousCommand->sampler_(stage, samplerSlotIdx) != sampler)) {
-				commandList.setSampler(sampler.get(), stage, samplerSlotIdx);
-			}
-		}
+	if (
+		!sameBindings(samplers_, other.samplers_) ||
+		!sameBindings(resources_, other.resources_) ||
+		!sameBindings(constantBuffers_, other.constantBuffers_) ||
+		!sameBindings(sharedConstantBuffers_, other.sharedConstantBuffers_)
+		)
+	{
+		return false;
+	}
 
-		for (const auto resourceSlotIdx : range<size_t>(0u, graphics::RESOURCE_SLOT_COUNT_PER_SHADER)) {
-			const auto resource = resource_(stage, resourceSlotIdx);
-			if (!previousCommand || (previousCommand->resource_(stage, resourceSlotIdx) != resource)) {
-				commandList.setResource(resource.get(), stage, resourceSlotIdx);
-			}
+	for (const auto& constantBuffer : constantBuffers_) {
+		const auto data = constantBufferData(constantBuffer.stage, constantBuffer.slot);
+		const auto otherData = other.constantBufferData(constantBuffer.stage, constantBuffer.slot);
+		if (!sameData(data, otherData)) {
+			return false;
 		}
+	}
 
-		for (const auto constantBufferSlotIdx : range<size_t>(0u, graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER)) {
-			const auto constantBuffer = constantBuffer_(stage, constantBufferSlotIdx);
-			const auto data = constantBufferData(stage, constantBufferSlotIdx);
+	return true;
+}
+
+void DrawCommand::bind_(StateCache& stateCache) const {
+	stateCache.setViewport(control_.viewport());
+	stateCache.setRenderTarget(control_.renderTarget(), control_.depthStencil());
+
+	stateCache.beginBindings();
+
+	for (const auto& sampler : samplers_) {
+		stateCache.setSampler(sampler.handle, sampler.stage, sampler.slot);
+	}
 
-			if (data.size() > 0u) {
-				// TODO: lock should return a std::unique_ptr<BufferView, ...> instead of uint8_t. size is retrievable
-				// from resource anyway
-				auto outPtr = commandList.lock(constantBuffer, graphics::CommandList::LockPurpose::WRITE_DISCARD);
-				std::memcpy(outPtr.pixels.get(), data.data(), data.size());
-			}
+	for (const auto& resource : resources_) {
+		stateCache.setResource(resource.handle, resource.stage, resource.slot);
+	}
 
-			commandList.setConstantBuffer(constantBuffer, stage, constantBufferSlotIdx);
+	assert(static_cast<bool>(constantDataArena_) || constantBuffers_.empty());
+	for (const auto& constantBuffer : constantBuffers_) {
+		if (constantBuffer.data.size > 0u) {
+			stateCache.setConstantData(
+				constantBuffer.handle, *constantDataArena_, constantBuffer.data, constantBuffer.stage, constantBuffer.slot);
+		} else {
+			stateCache.setConstantBuffer(constantBuffer.handle, constantBuffer.stage, constantBuffer.slot);
 		}
 	}
 
-	assert(static_cast<bool>(technique_));
-	technique_->bind(commandList);
+	for (const auto& sharedConstantBuffer : sharedConstantBuffers_) {
+		// the technique should have marked the slot external, see shader::Technique::setExternalConstantBuffer
+		assert(!findBinding_(constantBuffers_, sharedConstantBuffer.stage, sharedConstantBuffer.slot));
 
-	commandList.setVertexBuffer(vertexBuffer_, 0u, vertexStride_);
-	commandList.setIndexBuffer(indexBuffer_, 0u, indexStride_);
+		stateCache.uploadConstantBuffer(sharedConstantBuffer.handle);
+		stateCache.setConstantBuffer(
+			sharedConstantBuffer.handle.buffer(), sharedConstantBuffer.stage, sharedConstantBuffer.slot);
+	}
 
-	if (indexCount_ > 0u) {
-		commandList.drawIndexed(0u, indexCount_, primitiveTopology_);
+	stateCache.endBindings();
+
+	assert(static_cast<bool>(pipelineState_));
+	stateCache.setPipelineState(pipelineState_);
+
+	stateCache.setVertexBuffer(vertexBuffer_, vertexStride_);
+}
+
+void DrawCommand::reset() {
+	control_ = Control();
+	technique_.reset();
+	pipelineState_ = shader::PipelineState();
+
+	samplers_.clear();
+	resources_.clear();
+	constantBuffers_.clear();
+	sharedConstantBuffers_.clear();
+
+	vertexBuffer_ = graphics::Buffer();
+	vertexCount_ = 0u;
+	vertexStride_ = 0u;
+	vertexCapacity_ = 0u;
+	vertexData_ = ConstantDataArena::Allocation();
+
+	indexBuffer_ = graphics::Buffer();
+	indexStride_ = 0u;
+	indexCount_ = 0u;
+	startingIndex_ = 0u;
+
+	primitiveTopology_ = graphics::PrimitiveTopology::INVALID;
+
+	instanceBuffer_ = graphics::Buffer();
+	instanceCapacity_ = 0u;
+	instanceStride_ = 0u;
+	instanceData_ = ConstantDataArena::Allocation();
+}
+
+void DrawCommand::resetConstantBufferData() {
+	for (auto& constantBuffer : constantBuffers_) {
+		constantBuffer.data = ConstantDataArena::Allocation();
+	}
+
+	vertexData_ = ConstantDataArena::Allocation();
+	instanceData_ = ConstantDataArena::Allocation();
+}
+
+void DrawCommand::setRenderControl(const Control& control) {
+	control_ = control;
+
+	if (technique_) {
+		pipelineState_ = shader::PipelineState(*technique_, control_.renderState());
+	}
+}
+
+void DrawCommand::setTechnique(essentials::observer_ptr<const shader::Technique> technique) {
+	technique_ = std::move(technique);
+
+	if (technique_) {
+		pipelineState_ = shader::PipelineState(*technique_, control_.renderState());
 	} else {
-		commandList.draw(0u, vertexCount_, primitiveTopology_);
+		pipelineState_ = shader::PipelineState();
 	}
 }
 
+essentials::BufferView DrawCommand::allocateConstantBufferData(
+	graphics::ShaderType stage, size_t slot, size_t size)
+{
+	assert(static_cast<bool>(constantDataArena_));
+	assert(slot < graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
+
+	auto& constantBuffer = binding_(constantBuffers_, stage, slot);
+	constantBuffer.data = constantDataArena_->allocate(size, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	return constantDataArena_->view(constantBuffer.data);
+}
+
+essentials::ConstBufferView DrawCommand::constantBufferData(graphics::ShaderType stage, size_t slot) const {
+	const auto* constantBuffer = findBinding_(constantBuffers_, stage, slot);
+	if (!constantBuffer || constantBuffer->data.size == 0u) {
+		return essentials::ConstBufferView();
+	}
+
+	const auto& constantDataArena = *constantDataArena_;
+	return constantDataArena.view(constantBuffer->data);
+}
+
+essentials::BufferView DrawCommand::allocateVertexData(size_t size) {
+	assert(static_cast<bool>(vertexDataArena_));
+	assert(!instanced());
+
+	vertexData_ = vertexDataArena_->allocate(size);
+	return vertexDataArena_->view(vertexData_);
+}
+
+essentials::ConstBufferView DrawCommand::vertexData() const {
+	if (vertexData_.size == 0u) {
+		return essentials::ConstBufferView();
+	}
+
+	const auto& vertexDataArena = *vertexDataArena_;
+	return vertexDataArena.view(vertexData_);
+}
+
+essentials::BufferView DrawCommand::allocateInstanceData() {
+	assert(static_cast<bool>(vertexDataArena_));
+	assert(instanced());
+
+	instanceData_ = vertexDataArena_->allocate(instanceStride_);
+	return vertexDataArena_->view(instanceData_);
+}
+
+essentials::ConstBufferView DrawCommand::instanceData() const {
+	if (instanceData_.size == 0u) {
+		return essentials::ConstBufferView();
+	}
+
+	const auto& vertexDataArena = *vertexDataArena_;
+	return vertexDataArena.view(instanceData_);
+}
+
 void detail::declareDrawCommand() {
 	ponder::Class::declare<DrawCommand>("dormouse_engine::renderer::command::DrawCommand");
 }
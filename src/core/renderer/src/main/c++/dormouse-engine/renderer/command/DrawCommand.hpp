@@ -1,6 +1,13 @@
 #ifndef _DORMOUSEENGINE_RENDERER_COMMAND_DRAWCOMMAND_HPP_
 #define _DORMOUSEENGINE_RENDERER_COMMAND_DRAWCOMMAND_HPP_
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
 #pragma warning(push, 3)
 #	include <ponder/pondertype.hpp>
 #pragma warning(pop)
@@ -10,50 +17,120 @@
 #include "dormouse-engine/graphics/PrimitiveTopology.hpp"
 #include "dormouse-engine/essentials/observer_ptr.hpp"
 #include "dormouse-engine/essentials/memory.hpp"
+#include "../control/ConstantBuffer.hpp"
 #include "../control/Sampler.hpp"
 #include "../control/ResourceView.hpp"
 #include "../control/Control.hpp"
+#include "../shader/PipelineState.hpp"
 #include "../shader/Technique.hpp"
 #include "Command.hpp"
 #include "CommandKey.hpp"
+#include "ConstantDataArena.hpp"
 
 namespace dormouse_engine::renderer::command {
 
+// A draw call with its full pipeline state. The command keeps only the bindings that were set, ordered
+// by stage and slot, and refers to its constant buffer data by offset into a ConstantDataArena shared by
+// all commands of a command buffer. Vertex and instance data are kept in a second arena, so that only
+// constant data is staged to a ConstantUploadBuffer.
+// Instanced commands additionally carry per-instance vertex data. Consecutive instanced commands with the
+// same state are drawn together by an InstanceBatcher.
 class DrawCommand final : public Command {
 public:
 
+	template <class HandleType>
+	struct Binding {
+
+		graphics::ShaderType stage;
+
+		std::uint32_t slot;
+
+		HandleType handle;
+
+	};
+
+	struct ConstantBufferBinding : Binding<graphics::Buffer> {
+
+		ConstantDataArena::Allocation data;
+
+	};
+
+	// Bindings of each kind stored in the command itself, enough for most commands, so that recording one
+	// doesn't allocate. Further bindings spill to the heap.
+	static constexpr auto INLINE_BINDING_COUNT = size_t(4);
+
+	template <class BindingType>
+	using BindingTable = boost::container::small_vector<BindingType, INLINE_BINDING_COUNT>;
+
+	using SamplerBindings = BindingTable<Binding<control::Sampler>>;
+
+	using ResourceBindings = BindingTable<Binding<control::ResourceView>>;
+
+	using ConstantBufferBindings = BindingTable<ConstantBufferBinding>;
+
+	using SharedConstantBufferBindings = BindingTable<Binding<control::ConstantBuffer>>;
+
 	CommandKey key() const override {
 		return control_.commandKey();
 	}
 
-	void submit(graphics::CommandList& commandList, const Command* previous) const override;
+	void submit(StateCache& stateCache) const override;
 
-	void setRenderControl(const Control& control) {
-		control_ = std::move(control);
+	// Restores the default state, keeping the capacity of the binding tables.
+	void reset();
+
+	// Drops constant buffer, vertex and instance data allocations, keeping the buffer bindings. Called when the
+	// constant data arena is reset, but the command is going to be re-used.
+	void resetConstantBufferData();
+
+	void setConstantDataArena(essentials::observer_ptr<ConstantDataArena> constantDataArena) {
+		constantDataArena_ = std::move(constantDataArena);
 	}
 
-	void setTechnique(essentials::observer_ptr<const shader::Technique> technique) {
-		technique_ = std::move(technique);
+	void setVertexDataArena(essentials::observer_ptr<ConstantDataArena> vertexDataArena) {
+		vertexDataArena_ = std::move(vertexDataArena);
 	}
 
-	void setSampler(control::Sampler sampler, graphics::ShaderType stage, size_t slot) {		
-		sampler_(stage, slot) = std::move(sampler);
+	// Setting the render control or the technique interns their pipeline state, see shader::PipelineState.
+	void setRenderControl(const Control& control);
+
+	void setTechnique(essentials::observer_ptr<const shader::Technique> technique);
+
+	void setSampler(control::Sampler sampler, graphics::ShaderType stage, size_t slot) {
+		binding_(samplers_, stage, slot).handle = std::move(sampler);
 	}
 
 	void setResource(control::ResourceView resource, graphics::ShaderType stage, size_t slot) {
-		resource_(stage, slot) = std::move(resource);
+		binding_(resources_, stage, slot).handle = std::move(resource);
 	}
 
-	void setVertexBuffer(graphics::Buffer vertexBuffer, size_t vertexCount, size_t vertexStride) {
+	// vertexCapacity is the number of vertices vertexBuffer has room for, needed if vertex data is allocated.
+	void setVertexBuffer(
+		graphics::Buffer vertexBuffer, size_t vertexCount, size_t vertexStride, size_t vertexCapacity = 0u)
+	{
 		vertexBuffer_ = std::move(vertexBuffer);
 		vertexCount_ = vertexCount;
 		vertexStride_ = vertexStride;
+		vertexCapacity_ = vertexCapacity;
 	}
 
-	void setIndexBuffer(graphics::Buffer indexBuffer, size_t indexCount, size_t indexStride) {
+	// Draws indexCount indices, starting at startingIndex.
+	void setIndexBuffer(
+		graphics::Buffer indexBuffer, size_t indexCount, size_t indexStride, size_t startingIndex = 0u)
+	{
 		indexBuffer_ = std::move(indexBuffer);
 		indexCount_ = indexCount;
 		indexStride_ = indexStride;
+		startingIndex_ = startingIndex;
+	}
+
+	// Makes the command instanced. Its instance data is fed to the vertex shader from instanceBuffer bound
+	// at input slot 1, which must have room for instanceCapacity instances of instanceStride bytes. Only
+	// indexed draws may be instanced.
+	void setInstanceBuffer(graphics::Buffer instanceBuffer, size_t instanceCapacity, size_t instanceStride) {
+		instanceBuffer_ = std::move(instanceBuffer);
+		instanceCapacity_ = instanceCapacity;
+		instanceStride_ = instanceStride;
 	}
 
 	void setPrimitiveTopology(graphics::PrimitiveTopology primitiveTopology) {
@@ -61,21 +138,72 @@ public:
 	}
 
 	void setConstantBuffer(graphics::Buffer buffer, graphics::ShaderType stage, size_t slot) {
-		constantBuffer_(stage, slot) = std::move(buffer);
+		binding_(constantBuffers_, stage, slot).handle = std::move(buffer);
 	}
 
-	essentials::ConstBufferView constantBufferData(graphics::ShaderType stage, size_t slot) const {
-		assert(static_cast<size_t>(stage) < STAGE_COUNT);
-		assert(slot < graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
-		const auto idx = static_cast<size_t>(stage) * graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER + slot;
-		return essentials::viewBuffer(constantBufferData_[idx]);
+	// Binds a constant buffer shared with other commands, e.g. holding per-frame or per-view data. Its data
+	// is uploaded by the first command using it after each change, not per command. The technique must
+	// mark stage and slot with setExternalConstantBuffer, so that it doesn't bind its own buffer there.
+	void setSharedConstantBuffer(control::ConstantBuffer constantBuffer, graphics::ShaderType stage, size_t slot) {
+		binding_(sharedConstantBuffers_, stage, slot).handle = std::move(constantBuffer);
 	}
 
-	essentials::ByteVector& constantBufferData(graphics::ShaderType stage, size_t slot) {
-		assert(static_cast<size_t>(stage) < STAGE_COUNT);
-		assert(slot < graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
-		const auto idx = static_cast<size_t>(stage) * graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER + slot;
-		return constantBufferData_[idx];
+	// Allocates zero-filled data of given size in the constant data arena, to be uploaded to the constant
+	// buffer bound at stage and slot when the command is submitted, or bound as a range of the frame's
+	// ConstantUploadBuffer if there is one. The returned view is valid until the next allocation from the arena.
+	essentials::BufferView allocateConstantBufferData(graphics::ShaderType stage, size_t slot, size_t size);
+
+	essentials::ConstBufferView constantBufferData(graphics::ShaderType stage, size_t slot) const;
+
+	// Allocates zero-filled vertex data of given size in the vertex data arena, written to the vertex buffer
+	// when the command is submitted, behind the data of commands submitted before it in the frame - see
+	// StateCache::uploadVertexData. Lets commands recorded on any thread fill a dynamic vertex buffer shared by
+	// commands, which must have room for the data of each one. The returned view is valid until the next
+	// allocation from the arena.
+	essentials::BufferView allocateVertexData(size_t size);
+
+	essentials::ConstBufferView vertexData() const;
+
+	// Allocates zero-filled data of a single instance in the vertex data arena. Requires a prior call to
+	// setInstanceBuffer.
+	essentials::BufferView allocateInstanceData();
+
+	essentials::ConstBufferView instanceData() const;
+
+	bool instanced() const noexcept {
+		return instanceStride_ > 0u;
+	}
+
+	const graphics::Buffer& instanceBuffer() const noexcept {
+		return instanceBuffer_;
+	}
+
+	size_t instanceCapacity() const noexcept {
+		return instanceCapacity_;
+	}
+
+	// Returns true if other may be drawn as a following instance of this command, i.e. both are instanced
+	// and differ only in their keys and instance data.
+	bool canBatchWith(const DrawCommand& other) const;
+
+	// Binds the state of the command and draws instanceCount instances. Data of all instances must have been
+	// uploaded to the instance buffer.
+	void submitInstances(StateCache& stateCache, size_t instanceCount) const;
+
+	const SamplerBindings& samplers() const noexcept {
+		return samplers_;
+	}
+
+	const ResourceBindings& resources() const noexcept {
+		return resources_;
+	}
+
+	const ConstantBufferBindings& constantBuffers() const noexcept {
+		return constantBuffers_;
+	}
+
+	const SharedConstantBufferBindings& sharedConstantBuffers() const noexcept {
+		return sharedConstantBuffers_;
 	}
 
 private:
@@ -92,20 +220,20 @@ private:
 
 	essentials::observer_ptr<const shader::Technique> technique_;
 
-	// TODO: consider a different way of storing samplers, resources etc. Arrays are great, because they
-	// store data locally, but most of these control objects are null, so they're a waste of space.
-	std::array<control::Sampler, STAGE_COUNT * graphics::SAMPLER_SLOT_COUNT_PER_SHADER> samplers_;
+	// Technique combined with the render state of control_, valid once the technique is set
+	shader::PipelineState pipelineState_;
+
+	essentials::observer_ptr<ConstantDataArena> constantDataArena_;
 
-	std::array<control::ResourceView, STAGE_COUNT * graphics::RESOURCE_SLOT_COUNT_PER_SHADER> resources_;
+	essentials::observer_ptr<ConstantDataArena> vertexDataArena_;
 
-	// TODO: keeping graphics::Buffer here disallows updating constant buffer data only when it changes,
-	// i.e. if you have a constant buffer keeping per-frame data and you render multiple objects with it
-	// it will always be updated. Create control::Buffer that's capable of checking whether buffer data
-	// has changed and ensure that it is shared between objects by other moving it to shader::Shader or
-	// by allowing some extra kind of identification.
-	std::array<graphics::Buffer, STAGE_COUNT * graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER> constantBuffers_;
+	SamplerBindings samplers_;
 
-	std::array<essentials::ByteVector, STAGE_COUNT * graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER> constantBufferData_;
+	ResourceBindings resources_;
+
+	ConstantBufferBindings constantBuffers_;
+
+	SharedConstantBufferBindings sharedConstantBuffers_;
 
 	graphics::Buffer vertexBuffer_;
 
@@ -113,45 +241,71 @@ private:
 
 	size_t vertexStride_ = 0u;
 
+	size_t vertexCapacity_ = 0u;
+
+	ConstantDataArena::Allocation vertexData_;
+
 	graphics::Buffer indexBuffer_;
-	
+
 	size_t indexStride_ = 0u;
 
 	size_t indexCount_ = 0u;
 
+	size_t startingIndex_ = 0u;
+
 	graphics::PrimitiveTopology primitiveTopology_;
 
-	const control::Sampler& sampler_(graphics::ShaderType stage, size_t slot) const {
-		assert(static_cast<size_t>(stage) < STAGE_COUNT);
-		assert(slot < graphics::SAMPLER_SLOT_COUNT_PER_SHADER);
-		return samplers_[static_cast<size_t>(stage) * graphics::SAMPLER_SLOT_COUNT_PER_SHADER + slot];
-	}
+	graphics::Buffer instanceBuffer_;
 
-	control::Sampler& sampler_(graphics::ShaderType stage, size_t slot) {
-		return const_cast<control::Sampler&>(const_cast<const DrawCommand&>(*this).sampler_(stage, slot));
-	}
+	size_t instanceCapacity_ = 0u;
 
-	const control::ResourceView& resource_(graphics::ShaderType stage, size_t slot) const {
-		assert(static_cast<size_t>(stage) < STAGE_COUNT);
-		assert(slot < graphics::RESOURCE_SLOT_COUNT_PER_SHADER);
-		return resources_[static_cast<size_t>(stage) * graphics::RESOURCE_SLOT_COUNT_PER_SHADER + slot];
-	}
+	size_t instanceStride_ = 0u;
 
-	control::ResourceView& resource_(graphics::ShaderType stage, size_t slot) {
-		return const_cast<control::ResourceView&>(const_cast<const DrawCommand&>(*this).resource_(stage, slot));
-	}
+	ConstantDataArena::Allocation instanceData_;
+
+	void bind_(StateCache& stateCache) const;
 
-	const graphics::Buffer& constantBuffer_(graphics::ShaderType stage, size_t slot) const {
-		assert(static_cast<size_t>(stage) < STAGE_COUNT);
-		assert(slot < graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
-		return constantBuffers_[static_cast<size_t>(stage) * graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER + slot];
+	// Returns the binding at stage and slot, inserting a default one, so that bindings stay ordered.
+	template <class BindingType>
+	static BindingType& binding_(BindingTable<BindingType>& bindings, graphics::ShaderType stage, size_t slot);
+
+	template <class BindingType>
+	static const BindingType* findBinding_(
+		const BindingTable<BindingType>& bindings, graphics::ShaderType stage, size_t slot);
+
+};
+
+template <class BindingType>
+BindingType& DrawCommand::binding_(BindingTable<BindingType>& bindings, graphics::ShaderType stage, size_t slot) {
+	assert(static_cast<size_t>(stage) < STAGE_COUNT);
+
+	auto it = std::lower_bound(bindings.begin(), bindings.end(), std::make_pair(stage, slot),
+		[](const BindingType& binding, const std::pair<graphics::ShaderType, size_t>& position) {
+			return std::make_pair(binding.stage, size_t(binding.slot)) < position;
+		});
+
+	if (it == bindings.end() || it->stage != stage || it->slot != slot) {
+		auto binding = BindingType();
+		binding.stage = stage;
+		binding.slot = static_cast<std::uint32_t>(slot);
+		it = bindings.insert(it, std::move(binding));
 	}
 
-	graphics::Buffer& constantBuffer_(graphics::ShaderType stage, size_t slot) {
-		return const_cast<graphics::Buffer&>(const_cast<const DrawCommand&>(*this).constantBuffer_(stage, slot));
+	return *it;
+}
+
+template <class BindingType>
+const BindingType* DrawCommand::findBinding_(
+	const BindingTable<BindingType>& bindings, graphics::ShaderType stage, size_t slot)
+{
+	for (const auto& binding : bindings) {
+		if (binding.stage == stage && binding.slot == slot) {
+			return &binding;
+		}
 	}
 
-};
+	return nullptr;
+}
 
 namespace detail { void declareDrawCommand(); }
 
@@ -0,0 +1,43 @@
+#include "InstanceBatcher.hpp"
+
+#include <cassert>
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer::command;
+
+void InstanceBatcher::submit(StateCache& stateCache, const DrawCommand& command) {
+	if (first_ && instanceCount_ < first_->instanceCapacity() && first_->canBatchWith(command)) {
+		const auto data = command.instanceData();
+		instanceData_.insert(instanceData_.end(), data.data(), data.data() + data.size());
+		++instanceCount_;
+		return;
+	}
+
+	flush(stateCache);
+
+	if (command.instanced()) {
+		const auto data = command.instanceData();
+		first_ = &command;
+		instanceCount_ = 1u;
+		instanceData_.assign(data.data(), data.data() + data.size());
+	} else {
+		command.submit(stateCache);
+	}
+}
+
+void InstanceBatcher::flush(StateCache& stateCache) {
+	if (!first_) {
+		return;
+	}
+
+	if (instanceCount_ == 1u) {
+		first_->submit(stateCache);
+	} else {
+		stateCache.uploadInstanceData(first_->instanceBuffer(), essentials::viewBuffer(instanceData_));
+		first_->submitInstances(stateCache, instanceCount_);
+	}
+
+	first_ = nullptr;
+	instanceCount_ = 0u;
+	instanceData_.clear();
+}
@@ -0,0 +1,35 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_INSTANCEBATCHER_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_INSTANCEBATCHER_HPP_
+
+#include <vector>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "DrawCommand.hpp"
+#include "StateCache.hpp"
+
+namespace dormouse_engine::renderer::command {
+
+// Submits a stream of draw commands, coalescing runs of consecutive instanced commands that may be batched
+// together (see DrawCommand::canBatchWith) into a single instanced draw. Instance data of a run is gathered
+// and uploaded to the instance buffer in one go. Runs longer than the instance buffer capacity are split.
+class InstanceBatcher final {
+public:
+
+	void submit(StateCache& stateCache, const DrawCommand& command);
+
+	// Draws the pending run. Must be called after the last command has been submitted.
+	void flush(StateCache& stateCache);
+
+private:
+
+	const DrawCommand* first_ = nullptr;
+
+	size_t instanceCount_ = 0u;
+
+	std::vector<essentials::Byte> instanceData_;
+
+};
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_INSTANCEBATCHER_HPP_ */
@@ -0,0 +1,88 @@
+#include "ParallelCommandBuffer.hpp"
+
+#include <cassert>
+#include <string>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer::command;
+
+ParallelCommandBuffer::ParallelCommandBuffer(size_t threadCount) :
+	buffers_(std::max<size_t>(threadCount, 1u))
+{
+	mergeHeap_.reserve(buffers_.size());
+
+	freeBufferIndices_.reserve(buffers_.size());
+	for (auto bufferIdx = buffers_.size(); bufferIdx > 0u; --bufferIdx) {
+		freeBufferIndices_.emplace_back(bufferIdx - 1u);
+	}
+}
+
+ParallelCommandBuffer::BufferLease::BufferLease(ParallelCommandBuffer& owner, size_t bufferIdx) noexcept :
+	owner_(owner),
+	bufferIdx_(bufferIdx)
+{
+}
+
+ParallelCommandBuffer::BufferLease::~BufferLease() {
+	auto lock = std::lock_guard<std::mutex>(owner_.leaseMutex_);
+	owner_.freeBufferIndices_.emplace_back(bufferIdx_);
+}
+
+CommandBuffer& ParallelCommandBuffer::threadBuffer(size_t threadIdx) {
+	assert(threadIdx < buffers_.size());
+	return buffers_[threadIdx];
+}
+
+ParallelCommandBuffer::BufferLease ParallelCommandBuffer::lease() {
+	auto lock = std::lock_guard<std::mutex>(leaseMutex_);
+
+	if (freeBufferIndices_.empty()) {
+		throw exceptions::LogicError(
+			"Command buffers leased more than " + std::to_string(buffers_.size()) + " times at once");
+	}
+
+	const auto bufferIdx = freeBufferIndices_.back();
+	freeBufferIndices_.pop_back();
+
+	return BufferLease(*this, bufferIdx);
+}
+
+void ParallelCommandBuffer::submit(dormouse_engine::graphics::CommandList& commandList) {
+	if (!stateCache_ || &stateCache_->commandList() != &commandList) {
+		stateCache_ = std::make_unique<StateCache>(commandList);
+	}
+
+	auto& stateCache = *stateCache_;
+	stateCache.beginFrame();
+
+	if (constantUploadBuffer_) {
+		constantUploadBuffer_->reset();
+		for (const auto& buffer : buffers_) {
+			constantUploadBuffer_->stage(buffer.constantDataArena());
+		}
+		stateCache.uploadStagedConstantData(*constantUploadBuffer_);
+	}
+
+	forEachSorted([this, &stateCache](const DrawCommand& command) {
+			instanceBatcher_.submit(stateCache, command);
+		});
+	instanceBatcher_.flush(stateCache);
+
+	lastFrameStatistics_ = stateCache.statistics();
+
+	clear();
+}
+
+void ParallelCommandBuffer::invalidateState() {
+	if (stateCache_) {
+		stateCache_->invalidate();
+	}
+}
+
+void ParallelCommandBuffer::clear() {
+	for (auto& buffer : buffers_) {
+		buffer.clear();
+	}
+}
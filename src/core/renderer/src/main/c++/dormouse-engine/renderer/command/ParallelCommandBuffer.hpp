@@ -0,0 +1,162 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_PARALLELCOMMANDBUFFER_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_PARALLELCOMMANDBUFFER_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "dormouse-engine/essentials/observer_ptr.hpp"
+#include "dormouse-engine/graphics/CommandList.hpp"
+#include "CommandBuffer.hpp"
+#include "ConstantUploadBuffer.hpp"
+#include "InstanceBatcher.hpp"
+#include "StateCache.hpp"
+
+namespace dormouse_engine::renderer::command {
+
+// A set of command buffers, one per recording thread. Threads record into their own buffer without
+// synchronisation, submit merges the sorted per-thread runs into a single stream.
+class ParallelCommandBuffer final {
+public:
+
+	// Exclusive use of one of the buffers, returned to the pool on destruction. The commands recorded
+	// stay in the buffer until submitted, only the buffer may be leased again.
+	class BufferLease final : boost::noncopyable {
+	public:
+
+		~BufferLease();
+
+		CommandBuffer& buffer() noexcept {
+			return owner_.buffers_[bufferIdx_];
+		}
+
+	private:
+
+		ParallelCommandBuffer& owner_;
+
+		size_t bufferIdx_;
+
+		BufferLease(ParallelCommandBuffer& owner, size_t bufferIdx) noexcept;
+
+		friend class ParallelCommandBuffer;
+
+	};
+
+	explicit ParallelCommandBuffer(size_t threadCount = std::thread::hardware_concurrency());
+
+	size_t threadCount() const noexcept {
+		return buffers_.size();
+	}
+
+	// Buffer for worker threadIdx. Each worker must use a different index. Shouldn't be mixed with lease
+	// within a frame, as the leased buffer may be one of the indexed ones.
+	CommandBuffer& threadBuffer(size_t threadIdx);
+
+	// Leases a buffer not leased by anyone else, for code which doesn't know its worker index. Throws if
+	// all threadCount buffers are leased. Takes a lock, so the lease should be kept for the duration of
+	// the recording.
+	BufferLease lease();
+
+	// Calls func with the commands of all buffers in key order, merging the sorted per-thread runs.
+	// Commands with equal keys are visited in buffer order. Must not be called concurrently with recording.
+	template <class Func>
+	void forEachSorted(Func func);
+
+	// If set, constant data of the commands of all buffers is written to uploadBuffer with a single lock per
+	// submit instead of being uploaded command by command.
+	void setConstantUploadBuffer(essentials::observer_ptr<ConstantUploadBuffer> uploadBuffer) {
+		constantUploadBuffer_ = std::move(uploadBuffer);
+	}
+
+	// Submits the commands of all buffers in key order and clears the buffers.
+	// Consecutive compatible instanced commands are drawn with a single instanced draw call.
+	// The state bound is tracked between submits to the same command list, see invalidateState.
+	void submit(dormouse_engine::graphics::CommandList& commandList);
+
+	// Forgets the state bound by previous submits, to be called if state was bound through the command list
+	// other than by this buffer.
+	void invalidateState();
+
+	// Binds, uploads and draws of the last submit, including the ones elided by the state cache.
+	const StateCache::Statistics& lastFrameStatistics() const noexcept {
+		return lastFrameStatistics_;
+	}
+
+	void clear();
+
+private:
+
+	struct MergeCursor {
+		const CommandBuffer::SortEntry* current;
+		const CommandBuffer::SortEntry* end;
+		size_t bufferIdx;
+	};
+
+	// std heap functions build a max-heap, so the comparison is reversed to get the lowest key on top.
+	// Ties are broken by buffer index to keep the merge deterministic.
+	static bool mergeCursorAfter_(const MergeCursor& lhs, const MergeCursor& rhs) noexcept {
+		if (lhs.current->key != rhs.current->key) {
+			return lhs.current->key > rhs.current->key;
+		}
+		return lhs.bufferIdx > rhs.bufferIdx;
+	}
+
+	using MergeCursors = std::vector<MergeCursor>;
+
+	std::vector<CommandBuffer> buffers_;
+
+	std::mutex leaseMutex_;
+
+	// Indices of buffers not leased, the lowest at the back
+	std::vector<size_t> freeBufferIndices_;
+
+	MergeCursors mergeHeap_;
+
+	InstanceBatcher instanceBatcher_;
+
+	essentials::observer_ptr<ConstantUploadBuffer> constantUploadBuffer_;
+
+	// Cache of the command list last submitted to
+	std::unique_ptr<StateCache> stateCache_;
+
+	StateCache::Statistics lastFrameStatistics_;
+
+};
+
+template <class Func>
+void ParallelCommandBuffer::forEachSorted(Func func) {
+	mergeHeap_.clear();
+	for (auto bufferIdx = size_t(0); bufferIdx < buffers_.size(); ++bufferIdx) {
+		auto& buffer = buffers_[bufferIdx];
+		buffer.sort();
+
+		const auto& sortedCommands = buffer.sortedCommands();
+		if (!sortedCommands.empty()) {
+			mergeHeap_.emplace_back(
+				MergeCursor{ sortedCommands.data(), sortedCommands.data() + sortedCommands.size(), bufferIdx });
+		}
+	}
+
+	std::make_heap(mergeHeap_.begin(), mergeHeap_.end(), &mergeCursorAfter_);
+
+	while (!mergeHeap_.empty()) {
+		std::pop_heap(mergeHeap_.begin(), mergeHeap_.end(), &mergeCursorAfter_);
+		auto& cursor = mergeHeap_.back();
+
+		func(*cursor.current->command);
+
+		if (++cursor.current == cursor.end) {
+			mergeHeap_.pop_back();
+		} else {
+			std::push_heap(mergeHeap_.begin(), mergeHeap_.end(), &mergeCursorAfter_);
+		}
+	}
+}
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_PARALLELCOMMANDBUFFER_HPP_ */
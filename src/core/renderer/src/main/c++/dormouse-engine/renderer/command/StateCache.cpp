@@ -0,0 +1,366 @@
+#include "StateCache.hpp"
+
+#include <cassert>
+#include <cstring>
+
+#include "dormouse-engine/essentials/hash-bytes.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+size_t slotIndex(graphics::ShaderType stage, size_t slot, size_t slotsPerStage) {
+	assert(slot < slotsPerStage);
+	return static_cast<size_t>(stage) * slotsPerStage + slot;
+}
+
+} // anonymous namespace
+
+StateCache::Statistics& StateCache::Statistics::operator+=(const Statistics& other) noexcept {
+	binds += other.binds;
+	elidedBinds += other.elidedBinds;
+	unbinds += other.unbinds;
+	uploads += other.uploads;
+	elidedUploads += other.elidedUploads;
+	uploadedBytes += other.uploadedBytes;
+	sharedUploads += other.sharedUploads;
+	elidedSharedUploads += other.elidedSharedUploads;
+	sharedUploadedBytes += other.sharedUploadedBytes;
+	vertexBufferDiscards += other.vertexBufferDiscards;
+	draws += other.draws;
+	instancedDraws += other.instancedDraws;
+	instances += other.instances;
+	return *this;
+}
+
+StateCache::StateCache(graphics::CommandList& commandList, std::pmr::memory_resource* memoryResource) :
+	commandList_(commandList),
+	memoryPool_(memoryResource),
+	samplers_(&memoryPool_),
+	resources_(&memoryPool_),
+	constantBuffers_(&memoryPool_),
+	constantBufferContentHashes_(&memoryPool_),
+	vertexBufferCursors_(&memoryPool_)
+{
+}
+
+template <class T>
+bool StateCache::update_(std::optional<T>& bound, const T& value) {
+	if (bound && *bound == value) {
+		++statistics_.elidedBinds;
+		return false;
+	}
+
+	bound = value;
+	++statistics_.binds;
+	return true;
+}
+
+void StateCache::invalidate() {
+	viewport_.reset();
+	renderTarget_.reset();
+	renderState_.reset();
+	technique_ = nullptr;
+	pipelineState_ = shader::PipelineState();
+	boundStages_ = shader::Technique::ALL_STAGES;
+	// occupancy is kept, as whatever this cache bound may still be on the device
+	samplers_.bound.fill(std::nullopt);
+	resources_.bound.fill(std::nullopt);
+	constantBuffers_.bound.fill(std::nullopt);
+	constantBufferContentHashes_.clear();
+	constantUploadBuffer_ = nullptr;
+	vertexBufferCursors_.clear();
+	vertexBuffer_.reset();
+	indexBuffer_.reset();
+	instanceBuffer_.reset();
+}
+
+void StateCache::beginFrame() {
+	statistics_ = Statistics();
+	// the buffers may have been destroyed since and their ids re-used
+	constantBufferContentHashes_.clear();
+	constantUploadBuffer_ = nullptr;
+	vertexBufferCursors_.clear();
+}
+
+void StateCache::setViewport(const control::Viewport& viewport) {
+	if (update_(viewport_, viewport)) {
+		commandList_.setViewport(viewport.get());
+	}
+}
+
+void StateCache::setRenderTarget(
+	const control::RenderTargetView& renderTarget, const control::DepthStencilView& depthStencil)
+{
+	if (update_(renderTarget_, RenderTargetBinding{ renderTarget, depthStencil })) {
+		commandList_.setRenderTarget(renderTarget.get(), depthStencil.get());
+	}
+}
+
+void StateCache::setRenderState(const control::RenderState& renderState) {
+	if (update_(renderState_, renderState)) {
+		commandList_.setRenderState(renderState.get());
+		pipelineState_ = shader::PipelineState();
+	}
+}
+
+void StateCache::setTechnique(const shader::Technique& technique) {
+	if (technique_ == &technique) {
+		++statistics_.elidedBinds;
+	} else {
+		++statistics_.binds;
+		bindTechnique_(technique);
+		pipelineState_ = shader::PipelineState();
+	}
+}
+
+void StateCache::setPipelineState(const shader::PipelineState& pipelineState) {
+	assert(static_cast<bool>(pipelineState));
+
+	if (pipelineState_ == pipelineState) {
+		++statistics_.elidedBinds;
+		return;
+	}
+
+	++statistics_.binds;
+	pipelineState_ = pipelineState;
+
+	// the parts are only looked up when the id changes, and may still be the same as the bound ones
+	const auto renderState = pipelineState.renderState();
+	if (!renderState_ || *renderState_ != renderState) {
+		renderState_ = renderState;
+		commandList_.setRenderState(renderState.get());
+	}
+
+	const auto& technique = pipelineState.technique();
+	if (technique_ != &technique) {
+		bindTechnique_(technique);
+	}
+}
+
+void StateCache::bindTechnique_(const shader::Technique& technique) {
+	technique.bind(commandList_, boundStages_);
+	technique_ = &technique;
+	boundStages_ = technique.activeStages();
+}
+
+template <class T, size_t SLOTS_PER_STAGE>
+void StateCache::occupy_(StageSlots<T, SLOTS_PER_STAGE>& slots, size_t slotIdx) {
+	slots.bindingSets[slotIdx] = bindingSet_;
+	if (!slots.isOccupied[slotIdx]) {
+		slots.isOccupied[slotIdx] = true;
+		slots.occupied.emplace_back(slotIdx);
+	}
+}
+
+template <class T, size_t SLOTS_PER_STAGE, class UnbindFunc>
+void StateCache::unbindUnused_(StageSlots<T, SLOTS_PER_STAGE>& slots, UnbindFunc unbind) {
+	for (auto idx = size_t(0); idx < slots.occupied.size(); ) {
+		const auto slotIdx = slots.occupied[idx];
+
+		if (slots.bindingSets[slotIdx] == bindingSet_) {
+			++idx;
+			continue;
+		}
+
+		unbind(static_cast<graphics::ShaderType>(slotIdx / SLOTS_PER_STAGE), slotIdx % SLOTS_PER_STAGE);
+		++statistics_.unbinds;
+
+		// null is not tracked as a binding, so that the next set goes through
+		slots.bound[slotIdx].reset();
+		slots.isOccupied[slotIdx] = false;
+		slots.occupied[idx] = slots.occupied.back();
+		slots.occupied.pop_back();
+	}
+}
+
+void StateCache::beginBindings() {
+	++bindingSet_;
+}
+
+void StateCache::endBindings() {
+	unbindUnused_(samplers_, [this](graphics::ShaderType stage, size_t slot) {
+			commandList_.setSampler(graphics::Sampler(), stage, slot);
+		});
+	unbindUnused_(resources_, [this](graphics::ShaderType stage, size_t slot) {
+			commandList_.setResource(graphics::ResourceView(), stage, slot);
+		});
+	unbindUnused_(constantBuffers_, [this](graphics::ShaderType stage, size_t slot) {
+			commandList_.setConstantBuffer(graphics::Buffer(), stage, slot);
+		});
+}
+
+void StateCache::setSampler(const control::Sampler& sampler, graphics::ShaderType stage, size_t slot) {
+	const auto slotIdx = slotIndex(stage, slot, graphics::SAMPLER_SLOT_COUNT_PER_SHADER);
+	occupy_(samplers_, slotIdx);
+	if (update_(samplers_.bound[slotIdx], sampler)) {
+		commandList_.setSampler(sampler.get(), stage, slot);
+	}
+}
+
+void StateCache::setResource(const control::ResourceView& resource, graphics::ShaderType stage, size_t slot) {
+	const auto slotIdx = slotIndex(stage, slot, graphics::RESOURCE_SLOT_COUNT_PER_SHADER);
+	occupy_(resources_, slotIdx);
+	if (update_(resources_.bound[slotIdx], resource)) {
+		commandList_.setResource(resource.get(), stage, slot);
+	}
+}
+
+void StateCache::setConstantBuffer(const graphics::Buffer& buffer, graphics::ShaderType stage, size_t slot) {
+	const auto slotIdx = slotIndex(stage, slot, graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
+	occupy_(constantBuffers_, slotIdx);
+	if (update_(constantBuffers_.bound[slotIdx], ConstantBufferBinding{ buffer.id(), 0u, 0u })) {
+		commandList_.setConstantBuffer(buffer, stage, slot);
+	}
+}
+
+void StateCache::setConstantData(const graphics::Buffer& buffer, const ConstantDataArena& arena,
+	const ConstantDataArena::Allocation& data, graphics::ShaderType stage, size_t slot)
+{
+	const auto arenaOffset = constantUploadBuffer_ ? constantUploadBuffer_->offset(arena) : std::nullopt;
+
+	if (!arenaOffset) {
+		uploadConstantBufferData(buffer, arena.view(data));
+		setConstantBuffer(buffer, stage, slot);
+		return;
+	}
+
+	const auto& uploadBuffer = constantUploadBuffer_->buffer();
+	const auto offset = *arenaOffset + data.offset;
+	const auto size = ConstantUploadBuffer::rangeSize(data.size);
+
+	assert(offset % graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT == 0u);
+
+	const auto slotIdx = slotIndex(stage, slot, graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER);
+	occupy_(constantBuffers_, slotIdx);
+	if (update_(constantBuffers_.bound[slotIdx], ConstantBufferBinding{ uploadBuffer.id(), offset, size })) {
+		commandList_.setConstantBuffer(uploadBuffer, stage, slot, offset, size);
+	}
+}
+
+void StateCache::uploadConstantBufferData(const graphics::Buffer& buffer, essentials::ConstBufferView data) {
+	upload_(buffer, data, essentials::hashBytes(data.data(), data.size()));
+}
+
+void StateCache::uploadStagedConstantData(ConstantUploadBuffer& uploadBuffer) {
+	const auto uploadedBytes = uploadBuffer.upload(commandList_);
+	if (uploadedBytes > 0u) {
+		++statistics_.uploads;
+		statistics_.uploadedBytes += uploadedBytes;
+	}
+
+	// the buffer may have been re-created, which invalidates any ranges bound before
+	constantBuffers_.bound.fill(std::nullopt);
+	constantUploadBuffer_ = &uploadBuffer;
+}
+
+void StateCache::uploadConstantBuffer(const control::ConstantBuffer& constantBuffer) {
+	if (constantBuffer.uploaded()) {
+		++statistics_.elidedUploads;
+		++statistics_.elidedSharedUploads;
+		return;
+	}
+
+	const auto data = constantBuffer.data();
+	write_(constantBuffer.buffer(), 0u, data, graphics::CommandList::LockPurpose::WRITE_DISCARD);
+	constantBuffer.markUploaded();
+
+	++statistics_.sharedUploads;
+	statistics_.sharedUploadedBytes += data.size();
+}
+
+void StateCache::uploadInstanceData(const graphics::Buffer& buffer, essentials::ConstBufferView data) {
+	upload_(buffer, data, essentials::hashBytes(data.data(), data.size()));
+}
+
+size_t StateCache::uploadVertexData(
+	const graphics::Buffer& buffer, size_t bufferSize, size_t stride, essentials::ConstBufferView data)
+{
+	assert(stride > 0u);
+	assert(data.size() <= bufferSize);
+
+	auto [it, inserted] = vertexBufferCursors_.try_emplace(buffer.id(), 0u);
+
+	// data is addressed by vertex index, so it starts at a multiple of stride
+	auto offset = (it->second + stride - 1u) / stride * stride;
+	auto lockPurpose = graphics::CommandList::LockPurpose::WRITE_NO_OVERWRITE;
+
+	if (inserted || offset + data.size() > bufferSize) {
+		offset = 0u;
+		lockPurpose = graphics::CommandList::LockPurpose::WRITE_DISCARD;
+		++statistics_.vertexBufferDiscards;
+	}
+
+	it->second = offset + data.size();
+	write_(buffer, offset, data, lockPurpose);
+
+	return offset / stride;
+}
+
+bool StateCache::upload_(
+	const graphics::Buffer& buffer, essentials::ConstBufferView data, std::uint64_t contentHash)
+{
+	auto [it, inserted] = constantBufferContentHashes_.try_emplace(buffer.id(), contentHash);
+
+	if (!inserted && it->second == contentHash) {
+		++statistics_.elidedUploads;
+		return false;
+	}
+
+	it->second = contentHash;
+	write_(buffer, 0u, data, graphics::CommandList::LockPurpose::WRITE_DISCARD);
+	return true;
+}
+
+void StateCache::write_(const graphics::Buffer& buffer, size_t offset, essentials::ConstBufferView data,
+	graphics::CommandList::LockPurpose lockPurpose)
+{
+	++statistics_.uploads;
+	statistics_.uploadedBytes += data.size();
+
+	// TODO: lock should return a std::unique_ptr<BufferView, ...> instead of uint8_t. size is retrievable
+	// from resource anyway
+	auto outPtr = commandList_.lock(buffer, lockPurpose);
+	std::memcpy(outPtr.pixels.get() + offset, data.data(), data.size());
+}
+
+void StateCache::setVertexBuffer(const graphics::Buffer& buffer, size_t stride) {
+	if (update_(vertexBuffer_, BufferBinding{ buffer.id(), stride })) {
+		commandList_.setVertexBuffer(buffer, 0u, stride);
+	}
+}
+
+void StateCache::setIndexBuffer(const graphics::Buffer& buffer, size_t stride) {
+	if (update_(indexBuffer_, BufferBinding{ buffer.id(), stride })) {
+		commandList_.setIndexBuffer(buffer, 0u, stride);
+	}
+}
+
+void StateCache::setInstanceBuffer(const graphics::Buffer& buffer, size_t stride) {
+	if (update_(instanceBuffer_, BufferBinding{ buffer.id(), stride })) {
+		commandList_.setVertexBuffer(buffer, 1u, stride);
+	}
+}
+
+void StateCache::draw(size_t vertexCount, graphics::PrimitiveTopology primitiveTopology, size_t startingVertex) {
+	++statistics_.draws;
+	commandList_.draw(startingVertex, vertexCount, primitiveTopology);
+}
+
+void StateCache::drawIndexed(
+	size_t startingIndex, size_t indexCount, graphics::PrimitiveTopology primitiveTopology, size_t baseVertex)
+{
+	++statistics_.draws;
+	commandList_.drawIndexed(startingIndex, indexCount, primitiveTopology, baseVertex);
+}
+
+void StateCache::drawIndexedInstanced(
+	size_t startingIndex, size_t indexCount, size_t instanceCount, graphics::PrimitiveTopology primitiveTopology)
+{
+	++statistics_.draws;
+	++statistics_.instancedDraws;
+	statistics_.instances += instanceCount;
+	commandList_.drawIndexedInstanced(indexCount, instanceCount, startingIndex, primitiveTopology);
+}
@@ -0,0 +1,304 @@
+#ifndef _DORMOUSEENGINE_RENDERER_COMMAND_STATECACHE_HPP_
+#define _DORMOUSEENGINE_RENDERER_COMMAND_STATECACHE_HPP_
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/graphics/CommandList.hpp"
+#include "dormouse-engine/graphics/PrimitiveTopology.hpp"
+#include "dormouse-engine/graphics/Resource.hpp"
+#include "dormouse-engine/graphics/Sampler.hpp"
+#include "dormouse-engine/graphics/ShaderType.hpp"
+#include "../control/ConstantBuffer.hpp"
+#include "../control/DepthStencilView.hpp"
+#include "../control/RenderState.hpp"
+#include "../control/RenderTargetView.hpp"
+#include "../control/ResourceView.hpp"
+#include "../control/Sampler.hpp"
+#include "../control/Viewport.hpp"
+#include "../shader/PipelineState.hpp"
+#include "../shader/Technique.hpp"
+#include "ConstantDataArena.hpp"
+#include "ConstantUploadBuffer.hpp"
+
+namespace dormouse_engine::renderer::command {
+
+// Front of a graphics::CommandList which tracks the device state bound through it and forwards only
+// actual changes. Constant buffer uploads are skipped if the buffer already holds data with the same
+// content hash, which is tracked within a frame. Shared control::ConstantBuffers record the content last
+// uploaded to them, which holds across frames and caches, so their data is written at most once per
+// content change. Command constant data staged in a ConstantUploadBuffer is written with a single lock per
+// frame and bound as ranges of that buffer. Vertex data is appended to its buffer, which is discarded only
+// once per frame or when it's full.
+// Render state and technique may be set together as a shader::PipelineState, which counts as a single bind
+// and is elided by comparing the pipeline state ids.
+// Shader stages left bound by the previous technique are cleared only if the new one doesn't use them.
+// Samplers, resources and constant buffers set between beginBindings and endBindings form one command's
+// binding set. Slots occupied by an earlier set but left empty by the current one are bound to null in
+// endBindings, so that bindings of one command don't leak into the draws of the next.
+// The tracked state starts unknown, so the first set of each kind always goes through. It's kept by
+// beginFrame, so a cache kept between frames, as command buffers do, elides binds across frames as well.
+// Techniques need to outlive the cache then, and invalidate must be called if anything else binds state
+// through the command list.
+class StateCache final {
+public:
+
+	struct Statistics {
+
+		size_t binds = 0u;
+
+		size_t elidedBinds = 0u;
+
+		size_t unbinds = 0u;
+
+		size_t uploads = 0u;
+
+		size_t elidedUploads = 0u;
+
+		size_t uploadedBytes = 0u;
+
+		size_t sharedUploads = 0u;
+
+		size_t elidedSharedUploads = 0u;
+
+		size_t sharedUploadedBytes = 0u;
+
+		size_t vertexBufferDiscards = 0u;
+
+		size_t draws = 0u;
+
+		size_t instancedDraws = 0u;
+
+		size_t instances = 0u;
+
+		Statistics& operator+=(const Statistics& other) noexcept;
+
+	};
+
+	// The tracking tables are allocated from a pool, which gets its memory from memoryResource.
+	explicit StateCache(
+		graphics::CommandList& commandList,
+		std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource()
+		);
+
+	graphics::CommandList& commandList() noexcept {
+		return commandList_;
+	}
+
+	const Statistics& statistics() const noexcept {
+		return statistics_;
+	}
+
+	// Forgets all tracked state, to be called if the device state was changed bypassing the cache.
+	void invalidate();
+
+	// Resets the statistics and forgets the content of buffers written in the previous frame and the staged
+	// ConstantUploadBuffer, so that the first vertex data written to each buffer discards its content. Bound
+	// state is kept.
+	void beginFrame();
+
+	void setViewport(const control::Viewport& viewport);
+
+	void setRenderTarget(const control::RenderTargetView& renderTarget, const control::DepthStencilView& depthStencil);
+
+	void setRenderState(const control::RenderState& renderState);
+
+	void setTechnique(const shader::Technique& technique);
+
+	void setPipelineState(const shader::PipelineState& pipelineState);
+
+	// Starts a new binding set.
+	void beginBindings();
+
+	// Binds null to the slots occupied by previous binding sets and not set in the current one.
+	void endBindings();
+
+	void setSampler(const control::Sampler& sampler, graphics::ShaderType stage, size_t slot);
+
+	void setResource(const control::ResourceView& resource, graphics::ShaderType stage, size_t slot);
+
+	void setConstantBuffer(const graphics::Buffer& buffer, graphics::ShaderType stage, size_t slot);
+
+	void uploadConstantBufferData(const graphics::Buffer& buffer, essentials::ConstBufferView data);
+
+	// Writes the arenas staged in uploadBuffer to the device. Until the cache is invalidated, data of those
+	// arenas passed to setConstantData is bound as ranges of uploadBuffer.
+	void uploadStagedConstantData(ConstantUploadBuffer& uploadBuffer);
+
+	// Binds constant data allocated in arena at stage and slot. Binds its range of the upload buffer if the
+	// arena was staged, uploads it to buffer and binds buffer otherwise.
+	void setConstantData(const graphics::Buffer& buffer, const ConstantDataArena& arena,
+		const ConstantDataArena::Allocation& data, graphics::ShaderType stage, size_t slot);
+
+	// Uploads the data of constantBuffer unless its current content is already in the device buffer, as
+	// recorded by control::ConstantBuffer::markUploaded.
+	void uploadConstantBuffer(const control::ConstantBuffer& constantBuffer);
+
+	void uploadInstanceData(const graphics::Buffer& buffer, essentials::ConstBufferView data);
+
+	// Writes data behind the vertex data written to buffer earlier in the frame, without overwriting what
+	// previous draws read, and returns the index of its first vertex of stride bytes. The first write of a
+	// frame, and one that doesn't fit in the bufferSize bytes left, discards the content of buffer instead
+	// and writes data to its start.
+	size_t uploadVertexData(
+		const graphics::Buffer& buffer, size_t bufferSize, size_t stride, essentials::ConstBufferView data);
+
+	void setVertexBuffer(const graphics::Buffer& buffer, size_t stride);
+
+	void setIndexBuffer(const graphics::Buffer& buffer, size_t stride);
+
+	// Binds buffer as the per-instance vertex data, at input slot 1.
+	void setInstanceBuffer(const graphics::Buffer& buffer, size_t stride);
+
+	void draw(size_t vertexCount, graphics::PrimitiveTopology primitiveTopology, size_t startingVertex = 0u);
+
+	void drawIndexed(size_t startingIndex, size_t indexCount, graphics::PrimitiveTopology primitiveTopology,
+		size_t baseVertex = 0u);
+
+	void drawIndexedInstanced(
+		size_t startingIndex, size_t indexCount, size_t instanceCount, graphics::PrimitiveTopology primitiveTopology);
+
+private:
+
+	static constexpr auto STAGE_COUNT = 5u; // vs, gs, hs, ds, ps
+
+	struct BufferBinding {
+
+		graphics::Resource::Id id;
+
+		size_t stride;
+
+		friend bool operator==(const BufferBinding& lhs, const BufferBinding& rhs) noexcept {
+			return lhs.id == rhs.id && lhs.stride == rhs.stride;
+		}
+
+	};
+
+	struct RenderTargetBinding {
+
+		control::RenderTargetView renderTarget;
+
+		control::DepthStencilView depthStencil;
+
+		friend bool operator==(const RenderTargetBinding& lhs, const RenderTargetBinding& rhs) noexcept {
+			return lhs.renderTarget == rhs.renderTarget && lhs.depthStencil == rhs.depthStencil;
+		}
+
+	};
+
+	// A whole buffer is bound with zero size.
+	struct ConstantBufferBinding {
+
+		graphics::Resource::Id id;
+
+		size_t offset;
+
+		size_t size;
+
+		friend bool operator==(const ConstantBufferBinding& lhs, const ConstantBufferBinding& rhs) noexcept {
+			return lhs.id == rhs.id && lhs.offset == rhs.offset && lhs.size == rhs.size;
+		}
+
+	};
+
+	template <class T, size_t SLOTS_PER_STAGE>
+	struct StageSlots {
+
+		static constexpr auto SLOT_COUNT = STAGE_COUNT * SLOTS_PER_STAGE;
+
+		std::array<std::optional<T>, SLOT_COUNT> bound;
+
+		// Slots which may hold a non-null binding on the device, listed in occupied and flagged in isOccupied
+		std::pmr::vector<size_t> occupied;
+
+		std::bitset<SLOT_COUNT> isOccupied;
+
+		// Binding set in which each slot was last set
+		std::array<std::uint32_t, SLOT_COUNT> bindingSets = {};
+
+		explicit StageSlots(std::pmr::memory_resource* memoryResource) :
+			occupied(memoryResource)
+		{
+		}
+
+	};
+
+	using ContentHashes = std::pmr::unordered_map<graphics::Resource::Id, std::uint64_t>;
+
+	// End of the vertex data written to each buffer in the current frame
+	using VertexBufferCursors = std::pmr::unordered_map<graphics::Resource::Id, size_t>;
+
+	graphics::CommandList& commandList_;
+
+	// Keeps the memory of the tracking tables when beginFrame clears them
+	std::pmr::unsynchronized_pool_resource memoryPool_;
+
+	Statistics statistics_;
+
+	std::optional<control::Viewport> viewport_;
+
+	std::optional<RenderTargetBinding> renderTarget_;
+
+	std::optional<control::RenderState> renderState_;
+
+	const shader::Technique* technique_ = nullptr;
+
+	// Invalid if render state or technique were last set separately
+	shader::PipelineState pipelineState_;
+
+	// Stages which may have a shader bound on the device
+	shader::Technique::StageMask boundStages_ = shader::Technique::ALL_STAGES;
+
+	StageSlots<control::Sampler, graphics::SAMPLER_SLOT_COUNT_PER_SHADER> samplers_;
+
+	StageSlots<control::ResourceView, graphics::RESOURCE_SLOT_COUNT_PER_SHADER> resources_;
+
+	StageSlots<ConstantBufferBinding, graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER> constantBuffers_;
+
+	std::uint32_t bindingSet_ = 0u;
+
+	const ConstantUploadBuffer* constantUploadBuffer_ = nullptr;
+
+	ContentHashes constantBufferContentHashes_;
+
+	VertexBufferCursors vertexBufferCursors_;
+
+	std::optional<BufferBinding> vertexBuffer_;
+
+	std::optional<BufferBinding> indexBuffer_;
+
+	std::optional<BufferBinding> instanceBuffer_;
+
+	// Stores value as the bound state and returns true if it differs from the previously bound one.
+	template <class T>
+	bool update_(std::optional<T>& bound, const T& value);
+
+	// Writes data to buffer unless it's known to hold content with the same hash already. Returns true if
+	// the data was written.
+	bool upload_(const graphics::Buffer& buffer, essentials::ConstBufferView data, std::uint64_t contentHash);
+
+	void write_(const graphics::Buffer& buffer, size_t offset, essentials::ConstBufferView data,
+		graphics::CommandList::LockPurpose lockPurpose);
+
+	void bindTechnique_(const shader::Technique& technique);
+
+	// Records that the slot at slotIdx was set in the current binding set.
+	template <class T, size_t SLOTS_PER_STAGE>
+	void occupy_(StageSlots<T, SLOTS_PER_STAGE>& slots, size_t slotIdx);
+
+	// Calls unbind with the stage and slot of each occupied slot not set in the current binding set.
+	template <class T, size_t SLOTS_PER_STAGE, class UnbindFunc>
+	void unbindUnused_(StageSlots<T, SLOTS_PER_STAGE>& slots, UnbindFunc unbind);
+
+};
+
+} // namespace dormouse_engine::renderer::command
+
+#endif /* _DORMOUSEENGINE_RENDERER_COMMAND_STATECACHE_HPP_ */
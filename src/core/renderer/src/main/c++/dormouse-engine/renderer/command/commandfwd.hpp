@@ -3,10 +3,17 @@
 
 namespace dormouse_engine::renderer::command {
 
-class CommandKey;
+class CommandKeyLayout;
+struct DefaultCommandKeyLayout;
+template <class LayoutType>
+class BasicCommandKey;
+using CommandKey = BasicCommandKey<DefaultCommandKeyLayout>;
 class CommandBuffer;
+class ParallelCommandBuffer;
 class Command;
 class DrawCommand;
+class InstanceBatcher;
+class StateCache;
 
 } // namespace dormouse_engine::renderer::command
 
@@ -0,0 +1,39 @@
+#include "ConstantBuffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include "dormouse-engine/essentials/hash-bytes.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::control;
+
+graphics::Buffer control::createConstantBuffer(graphics::Device& graphicsDevice, size_t size) {
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::CONSTANT_BUFFER;
+	configuration.size = size;
+	return graphics::Buffer(graphicsDevice, configuration);
+}
+
+ConstantBuffer::ConstantBuffer(graphics::Device& graphicsDevice, size_t size) :
+	state_(std::make_shared<State>())
+{
+	state_->buffer = createConstantBuffer(graphicsDevice, size);
+	state_->data.resize(size);
+	state_->contentHash = essentials::hashBytes(state_->data.data(), state_->data.size());
+}
+
+void ConstantBuffer::update(essentials::ConstBufferView data) {
+	assert(state_);
+	assert(data.size() <= state_->data.size());
+
+	auto& stored = state_->data;
+	std::copy(data.data(), data.data() + data.size(), stored.begin());
+	std::fill(stored.begin() + data.size(), stored.end(), essentials::Byte(0));
+
+	state_->contentHash = essentials::hashBytes(stored.data(), stored.size());
+}
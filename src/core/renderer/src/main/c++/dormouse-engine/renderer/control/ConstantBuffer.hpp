@@ -0,0 +1,81 @@
+#ifndef _DORMOUSEENGINE_RENDERER_CONTROL_CONSTANTBUFFER_HPP_
+#define _DORMOUSEENGINE_RENDERER_CONTROL_CONSTANTBUFFER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "dormouse-engine/graphics/Buffer.hpp"
+
+namespace dormouse_engine::renderer::control {
+
+// Creates a device constant buffer of given size, which may be written by the CPU.
+graphics::Buffer createConstantBuffer(graphics::Device& graphicsDevice, size_t size);
+
+// Constant buffer shared between commands, for data that changes at most once per frame or view, like the
+// view-projection transform. Commands bind the handle instead of carrying a copy of the data, and the data
+// is uploaded when they're submitted, only if its content changed since the last upload in any frame.
+// Copies refer to the same buffer. The data must not be updated while commands using it are submitted.
+class ConstantBuffer final {
+public:
+
+	ConstantBuffer() = default;
+
+	ConstantBuffer(graphics::Device& graphicsDevice, size_t size);
+
+	// Replaces the data of the buffer. data may be smaller than the buffer, the remainder is zero-filled.
+	void update(essentials::ConstBufferView data);
+
+	const graphics::Buffer& buffer() const noexcept {
+		return state_->buffer;
+	}
+
+	essentials::ConstBufferView data() const noexcept {
+		return essentials::ConstBufferView(state_->data.data(), state_->data.size());
+	}
+
+	std::uint64_t contentHash() const noexcept {
+		return state_->contentHash;
+	}
+
+	// Returns true if the current data was written to the device buffer, as recorded by markUploaded.
+	bool uploaded() const noexcept {
+		return state_->uploadedContentHash == state_->contentHash;
+	}
+
+	// Records that the current data was written to the device buffer. The record is shared by all copies.
+	void markUploaded() const noexcept {
+		state_->uploadedContentHash = state_->contentHash;
+	}
+
+private:
+
+	struct State {
+
+		graphics::Buffer buffer;
+
+		essentials::ByteVector data;
+
+		std::uint64_t contentHash;
+
+		std::optional<std::uint64_t> uploadedContentHash;
+
+	};
+
+	std::shared_ptr<State> state_;
+
+	friend bool operator==(const ConstantBuffer& lhs, const ConstantBuffer& rhs) {
+		return lhs.state_ == rhs.state_;
+	}
+
+	friend bool operator!=(const ConstantBuffer& lhs, const ConstantBuffer& rhs) {
+		return !(lhs == rhs);
+	}
+
+};
+
+} // namespace dormouse_engine::renderer::control
+
+#endif /* _DORMOUSEENGINE_RENDERER_CONTROL_CONSTANTBUFFER_HPP_ */
@@ -72,11 +72,11 @@ private:
 } // anonymous namespace
 
 void DepthStencilView::initialiseSystem(graphics::Device& graphicsDevice) {
-	graphicsDevice.addDeviceDestroyedHandler([]() { DepthStencilViewFactory::instance()->clear(); });
+	graphicsDevice.addDeviceDestroyedHandler([]() { DepthStencilViewFactory::reference().clear(); });
 }
 
 DepthStencilView::DepthStencilView(const graphics::Texture& texture) :
-	depthStencilViewId_(DepthStencilViewFactory::instance()->create(texture))
+	depthStencilViewId_(DepthStencilViewFactory::reference().create(texture))
 {
 }
 
@@ -84,6 +84,6 @@ graphics::DepthStencilView DepthStencilView::get() const {
 	if (depthStencilViewId_ == INVALID_DEPTHSTENCIL_VIEW_ID) {
 		return graphics::DepthStencilView();
 	} else {
-		return DepthStencilViewFactory::instance()->get(depthStencilViewId_);
+		return DepthStencilViewFactory::reference().get(depthStencilViewId_);
 	}
 }
@@ -91,14 +91,14 @@ private:
 } // anonymous namespace
 
 void RenderState::initialiseSystem(graphics::Device& graphicsDevice) {
-	graphicsDevice.addDeviceDestroyedHandler([]() { RenderStateFactory::instance()->clear(); });
+	graphicsDevice.addDeviceDestroyedHandler([]() { RenderStateFactory::reference().clear(); });
 }
 
 RenderState::RenderState(
 	graphics::Device& graphicsDevice,
 	graphics::RenderState::Configuration configuration
 	) :
-	renderStateId_(RenderStateFactory::instance()->create(graphicsDevice, configuration))
+	renderStateId_(RenderStateFactory::reference().create(graphicsDevice, configuration))
 {
 }
 
@@ -106,6 +106,6 @@ graphics::RenderState RenderState::get() const {
 	if (renderStateId_ == INVALID_RENDER_STATE_ID) {
 		return {};
 	} else {
-		return RenderStateFactory::instance()->get(renderStateId_);
+		return RenderStateFactory::reference().get(renderStateId_);
 	}
 }
@@ -24,6 +24,11 @@ public:
 
 	graphics::RenderState get() const;
 
+	// Identifies the configuration - render states created with equal configurations have the same id.
+	size_t id() const noexcept {
+		return renderStateId_;
+	}
+
 private:
 
 	static constexpr size_t INVALID_RENDER_STATE_ID = static_cast<size_t>(-1);
@@ -72,11 +72,11 @@ private:
 } // anonymous namespace
 
 void RenderTargetView::initialiseSystem(graphics::Device& graphicsDevice) {
-	graphicsDevice.addDeviceDestroyedHandler([]() { RenderTargetViewFactory::instance()->clear(); });
+	graphicsDevice.addDeviceDestroyedHandler([]() { RenderTargetViewFactory::reference().clear(); });
 }
 
 RenderTargetView::RenderTargetView(const graphics::Texture& texture) :
-	renderTargetViewId_(RenderTargetViewFactory::instance()->create(texture))
+	renderTargetViewId_(RenderTargetViewFactory::reference().create(texture))
 {
 }
 
@@ -84,6 +84,6 @@ graphics::RenderTargetView RenderTargetView::get() const {
 	if (renderTargetViewId_ == INVALID_RENDERTARGET_VIEW_ID) {
 		return graphics::RenderTargetView();
 	} else {
-		return RenderTargetViewFactory::instance()->get(renderTargetViewId_);
+		return RenderTargetViewFactory::reference().get(renderTargetViewId_);
 	}
 }
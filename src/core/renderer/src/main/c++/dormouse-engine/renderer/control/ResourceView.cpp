@@ -94,16 +94,16 @@ private:
 } // anonymous namespace
 
 void ResourceView::initialiseSystem(graphics::Device& graphicsDevice) {
-	graphicsDevice.addDeviceDestroyedHandler([]() { ResourceViewFactory::instance()->clear(); });
+	graphicsDevice.addDeviceDestroyedHandler([]() { ResourceViewFactory::reference().clear(); });
 }
 
 ResourceView::ResourceView(const graphics::Buffer& buffer, graphics::PixelFormat elementFormat) :
-	resourceViewId_(ResourceViewFactory::instance()->create(buffer, elementFormat))
+	resourceViewId_(ResourceViewFactory::reference().create(buffer, elementFormat))
 {
 }
 
 ResourceView::ResourceView(const graphics::Texture& texture) :
-	resourceViewId_(ResourceViewFactory::instance()->create(texture))
+	resourceViewId_(ResourceViewFactory::reference().create(texture))
 {
 }
 
@@ -111,7 +111,7 @@ graphics::ResourceView ResourceView::get() const {
 	if (resourceViewId_ == INVALID_RESOURCE_VIEW_ID) {
 		return {};
 	} else {
-		return ResourceViewFactory::instance()->get(resourceViewId_);
+		return ResourceViewFactory::reference().get(resourceViewId_);
 	}
 }
 
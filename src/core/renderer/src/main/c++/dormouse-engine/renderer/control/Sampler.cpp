@@ -99,21 +99,21 @@ private:
 } // anonymous namespace
 
 void Sampler::initialiseSystem(graphics::Device& graphicsDevice) {
-	graphicsDevice.addDeviceDestroyedHandler([]() { SamplerFactory::instance()->clear(); });
+	graphicsDevice.addDeviceDestroyedHandler([]() { SamplerFactory::reference().clear(); });
 }
 
 Sampler::Sampler(
 	graphics::Device& graphicsDevice,
 	graphics::Sampler::Configuration configuration
 	) :
-	samplerId_(SamplerFactory::instance()->create(graphicsDevice, configuration))
+	samplerId_(SamplerFactory::reference().create(graphicsDevice, configuration))
 {
 }
 graphics::Sampler Sampler::get() const {
 	if (samplerId_ == INVALID_SAMPLER_ID) {
 		return {};
 	} else {
-		return SamplerFactory::instance()->get(samplerId_);
+		return SamplerFactory::reference().get(samplerId_);
 	}
 }
 
@@ -92,11 +92,11 @@ private:
 } // anonymous namespace
 
 Viewport::Viewport(const graphics::Viewport::Configuration& configuration) :
-	viewportObjectId_(ViewportFactory::instance()->create(configuration))
+	viewportObjectId_(ViewportFactory::reference().create(configuration))
 {
 }
 
 graphics::Viewport Viewport::get() const {
 	assert(viewportObjectId_ != INVALID_VIEWPORT_OBJECT_ID);
-	return ViewportFactory::instance()->get(viewportObjectId_);
+	return ViewportFactory::reference().get(viewportObjectId_);
 }
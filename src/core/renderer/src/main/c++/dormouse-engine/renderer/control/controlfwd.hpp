@@ -11,6 +11,7 @@ class ResourceView;
 class Sampler;
 class Viewport;
 class Control;
+class ConstantBuffer;
 
 } // namespace dormouse_engine::renderer::control
 
@@ -0,0 +1,136 @@
+#include "SkylinePacker.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+// Padding is added to the right and bottom of each rectangle, and the bin is extended by padding in both
+// directions, so that rectangles touching the bin edges don't waste space on it.
+SkylinePacker::SkylinePacker(size_t width, size_t height, size_t padding) :
+	width_(width),
+	height_(height),
+	padding_(padding)
+{
+	clear();
+}
+
+std::optional<SkylinePacker::Rect> SkylinePacker::insert(size_t width, size_t height) {
+	if (width == 0u || height == 0u) {
+		return Rect{ 0u, 0u, width, height };
+	}
+
+	const auto paddedWidth = width + padding_;
+	const auto paddedHeight = height + padding_;
+
+	auto bestSegmentIdx = skyline_.size();
+	auto bestY = size_t(0);
+	auto bestTop = std::numeric_limits<size_t>::max();
+
+	for (auto segmentIdx = size_t(0); segmentIdx < skyline_.size(); ++segmentIdx) {
+		const auto y = fit_(segmentIdx, paddedWidth, paddedHeight);
+		// segments are ordered by x, so the first one found is leftmost on ties
+		if (y && *y + paddedHeight < bestTop) {
+			bestSegmentIdx = segmentIdx;
+			bestY = *y;
+			bestTop = *y + paddedHeight;
+		}
+	}
+
+	if (bestSegmentIdx == skyline_.size()) {
+		return std::nullopt;
+	}
+
+	const auto x = skyline_[bestSegmentIdx].x;
+	addSegment_(bestSegmentIdx, Segment{ x, bestTop, paddedWidth });
+	usedArea_ += width * height;
+
+	return Rect{ x, bestY, width, height };
+}
+
+std::optional<std::vector<SkylinePacker::Rect>> SkylinePacker::insert(const std::vector<Size>& sizes) {
+	auto order = std::vector<size_t>(sizes.size());
+	std::iota(order.begin(), order.end(), size_t(0));
+	std::stable_sort(order.begin(), order.end(), [&sizes](size_t lhs, size_t rhs) {
+			if (sizes[lhs].height != sizes[rhs].height) {
+				return sizes[lhs].height > sizes[rhs].height;
+			}
+			return sizes[lhs].width > sizes[rhs].width;
+		});
+
+	auto result = std::vector<Rect>(sizes.size());
+	for (const auto idx : order) {
+		const auto rect = insert(sizes[idx].width, sizes[idx].height);
+		if (!rect) {
+			return std::nullopt;
+		}
+		result[idx] = *rect;
+	}
+
+	return result;
+}
+
+void SkylinePacker::clear() {
+	usedArea_ = 0u;
+	skyline_.clear();
+	skyline_.emplace_back(Segment{ 0u, 0u, width_ + padding_ });
+}
+
+std::optional<size_t> SkylinePacker::fit_(size_t segmentIdx, size_t width, size_t height) const {
+	const auto binWidth = width_ + padding_;
+	const auto binHeight = height_ + padding_;
+
+	if (skyline_[segmentIdx].x + width > binWidth) {
+		return std::nullopt;
+	}
+
+	// the rectangle rests on the highest of the segments below it
+	auto y = size_t(0);
+	auto remainingWidth = width;
+	for (auto idx = segmentIdx; remainingWidth > 0u; ++idx) {
+		assert(idx < skyline_.size());
+
+		y = std::max(y, skyline_[idx].y);
+		if (y + height > binHeight) {
+			return std::nullopt;
+		}
+
+		remainingWidth -= std::min(remainingWidth, skyline_[idx].width);
+	}
+
+	return y;
+}
+
+void SkylinePacker::addSegment_(size_t segmentIdx, const Segment& segment) {
+	skyline_.insert(skyline_.begin() + segmentIdx, segment);
+
+	// cut off the segments covered by the new one
+	const auto end = segment.x + segment.width;
+	auto idx = segmentIdx + 1u;
+	while (idx < skyline_.size() && skyline_[idx].x < end) {
+		auto& covered = skyline_[idx];
+		const auto overlap = end - covered.x;
+
+		if (covered.width <= overlap) {
+			skyline_.erase(skyline_.begin() + idx);
+		} else {
+			covered.x += overlap;
+			covered.width -= overlap;
+			break;
+		}
+	}
+
+	// merge neighbours at the same height
+	for (auto mergeIdx = size_t(0); mergeIdx + 1u < skyline_.size();) {
+		if (skyline_[mergeIdx].y == skyline_[mergeIdx + 1u].y) {
+			skyline_[mergeIdx].width += skyline_[mergeIdx + 1u].width;
+			skyline_.erase(skyline_.begin() + mergeIdx + 1u);
+		} else {
+			++mergeIdx;
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#ifndef _DORMOUSEENGINE_RENDERER_D2_SKYLINEPACKER_HPP_
+#define _DORMOUSEENGINE_RENDERER_D2_SKYLINEPACKER_HPP_
+
+#include <optional>
+#include <vector>
+
+namespace dormouse_engine::renderer::d2 {
+
+// Packs rectangles into a fixed size bin using the skyline bottom-left heuristic. The skyline is the upper
+// edge of the packed area; each rectangle is placed where its top ends up lowest, leftmost on ties.
+// Packing is deterministic - the same sequence of inserts always yields the same placement.
+class SkylinePacker final {
+public:
+
+	struct Size {
+
+		size_t width;
+
+		size_t height;
+
+	};
+
+	struct Rect {
+
+		size_t x;
+
+		size_t y;
+
+		size_t width;
+
+		size_t height;
+
+	};
+
+	// Creates a packer for a width x height bin. Packed rectangles are kept at least padding texels apart.
+	SkylinePacker(size_t width, size_t height, size_t padding = 0u);
+
+	// Places a width x height rectangle, or returns std::nullopt if it doesn't fit.
+	std::optional<Rect> insert(size_t width, size_t height);
+
+	// Places all rectangles, higher ones first, as that packs better than the input order. Returns the
+	// placements in input order, or std::nullopt if any of them doesn't fit, in which case the packer is left
+	// with the rectangles that did.
+	std::optional<std::vector<Rect>> insert(const std::vector<Size>& sizes);
+
+	void clear();
+
+	size_t width() const noexcept {
+		return width_;
+	}
+
+	size_t height() const noexcept {
+		return height_;
+	}
+
+	// Area of the packed rectangles, excluding padding.
+	size_t usedArea() const noexcept {
+		return usedArea_;
+	}
+
+	// Fraction of the bin covered by the packed rectangles.
+	float occupancy() const noexcept {
+		return static_cast<float>(usedArea_) / static_cast<float>(width_ * height_);
+	}
+
+private:
+
+	struct Segment {
+
+		size_t x;
+
+		size_t y;
+
+		size_t width;
+
+	};
+
+	using Skyline = std::vector<Segment>;
+
+	size_t width_;
+
+	size_t height_;
+
+	size_t padding_;
+
+	size_t usedArea_ = 0u;
+
+	Skyline skyline_;
+
+	// Returns the lowest y at which a width x height rectangle may be placed at the left edge of the
+	// segment at segmentIdx, or std::nullopt if it would stick out of the bin.
+	std::optional<size_t> fit_(size_t segmentIdx, size_t width, size_t height) const;
+
+	void addSegment_(size_t segmentIdx, const Segment& segment);
+
+};
+
+} // namespace dormouse_engine::renderer::d2
+
+#endif /* _DORMOUSEENGINE_RENDERER_D2_SKYLINEPACKER_HPP_ */
@@ -13,7 +13,9 @@
 #include "../control/controlfwd.hpp"
 #include "../command/commandfwd.hpp"
 #include "../shader/Property.hpp"
+#include "../shader/TechniqueCompiler.hpp"
 #include "Layout.hpp"
+#include "TextureRegion.hpp"
 
 namespace dormouse_engine::renderer::d2 {
 
@@ -21,10 +23,29 @@ class Sprite final {
 public:
 
 	// TODO: temp - don't pass shader code here
-	static void initialiseSystem(graphics::Device& device, essentials::ConstBufferView shaderCode);
-
-	Sprite(const graphics::Texture& texture) :
-		textureView_(texture)
+	// Compiles the sprite techniques synchronously, through the application's shaderCache.
+	static void initialiseSystem(
+		graphics::Device& device,
+		essentials::ConstBufferView shaderCode,
+		shader::ShaderCache& shaderCache
+		);
+
+	// Compiles the sprite technique through techniqueCompiler.
+	static void initialiseSystem(
+		graphics::Device& device,
+		essentials::ConstBufferView shaderCode,
+		shader::TechniqueCompiler& techniqueCompiler
+		);
+
+	// Sets the transform applied to all sprites after their layout, e.g. to pan or zoom a 2D view. It is
+	// per-frame data, uploaded once after each change rather than with every sprite, so it must not be changed
+	// while commands drawing sprites are submitted.
+	static void setViewTransform(const math::Transform& viewTransform);
+
+	// Creates a sprite showing region of texture, e.g. one of the regions of a TextureAtlas.
+	Sprite(const graphics::Texture& texture, const TextureRegion& region = TextureRegion()) :
+		textureView_(texture),
+		region_(region)
 	{
 	}
 
@@ -40,6 +61,14 @@ public:
 
 	control::Sampler sampler() const noexcept;
 
+	const TextureRegion& region() const noexcept {
+		return region_;
+	}
+
+	void setRegion(const TextureRegion& region) noexcept {
+		region_ = region;
+	}
+
 	const Layout& layout() const noexcept {
 		return layout_;
 	}
@@ -52,6 +81,8 @@ private:
 
 	control::ResourceView textureView_;
 
+	TextureRegion region_;
+
 	Layout layout_;
 
 };
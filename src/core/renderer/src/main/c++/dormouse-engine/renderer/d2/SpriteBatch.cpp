@@ -0,0 +1,162 @@
+#include "SpriteBatch.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "dormouse-engine/essentials/arena/scratch.hpp"
+#include "dormouse-engine/essentials/observer_ptr.hpp"
+#include "dormouse-engine/math/homogeneous.hpp"
+#include "../command/CommandBuffer.hpp"
+#include "../command/DrawCommand.hpp"
+#include "../control/Control.hpp"
+#include "SpriteCommon.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+namespace /* anonymous */ {
+
+using Index = std::uint32_t;
+
+const auto VERTICES_PER_SPRITE = size_t(4);
+
+// Quads are drawn as triangle lists, as strips can't be joined in a single draw call
+const auto INDICES_PER_SPRITE = size_t(6);
+
+graphics::Buffer createVertexBuffer(graphics::Device& graphicsDevice, size_t capacity) {
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::VERTEX_BUFFER;
+	configuration.size = capacity * VERTICES_PER_SPRITE * sizeof(detail::SpriteCommon::Vertex);
+	return graphics::Buffer(graphicsDevice, configuration);
+}
+
+graphics::Buffer createIndexBuffer(graphics::Device& graphicsDevice, size_t capacity) {
+	// two triangles per quad, following the triangle strip order of SpriteCommon::quad
+	const Index quadIndices[] = { 0u, 1u, 2u, 2u, 1u, 3u };
+
+	auto indices = std::vector<Index>();
+	indices.reserve(capacity * INDICES_PER_SPRITE);
+	for (auto spriteIdx = size_t(0); spriteIdx < capacity; ++spriteIdx) {
+		for (const auto quadIndex : quadIndices) {
+			indices.emplace_back(static_cast<Index>(spriteIdx * VERTICES_PER_SPRITE + quadIndex));
+		}
+	}
+
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = false;
+	configuration.purpose = graphics::Buffer::CreationPurpose::INDEX_BUFFER;
+	configuration.size = indices.size() * sizeof(Index);
+	return graphics::Buffer(graphicsDevice, configuration, essentials::viewBuffer(indices));
+}
+
+detail::SpriteCommon::Vertex* writeQuad(detail::SpriteCommon::Vertex* target, const Sprite& sprite) {
+	const auto toNDC = sprite.layout().toNDC();
+
+	for (const auto& vertex : detail::SpriteCommon::quad()) {
+		const auto position = toNDC.apply(
+			math::HomogeneousPoint(math::Vec3(vertex.position.x(), vertex.position.y(), 0.0f))).to3dSpace();
+
+		target->position = math::Vec2(position.x(), position.y());
+		target->textureCoordinates = sprite.region().map(vertex.textureCoordinates);
+		++target;
+	}
+
+	return target;
+}
+
+} // anonymous namespace
+
+SpriteBatch::SpriteBatch(graphics::Device& graphicsDevice, size_t capacity) {
+	reserve_(graphicsDevice, std::max<size_t>(capacity, 1u));
+}
+
+void SpriteBatch::add(const Sprite& sprite) {
+	const auto texture = sprite.texture();
+
+	auto textureIt = std::find_if(textures_.begin(), textures_.end(), [&texture](const TextureEntry& entry) {
+			return entry.texture == texture;
+		});
+
+	if (textureIt == textures_.end()) {
+		textureIt = textures_.insert(textureIt, TextureEntry{ texture, &sprite, 0u });
+	}
+
+	++textureIt->spriteCount;
+	sprites_.emplace_back(SpriteEntry{ &sprite, static_cast<size_t>(textureIt - textures_.begin()) });
+}
+
+void SpriteBatch::render(
+	graphics::Device& graphicsDevice,
+	command::CommandBuffer& commandBuffer,
+	const shader::Property& properties,
+	const control::Control& renderControl
+	)
+{
+	if (sprites_.empty()) {
+		return;
+	}
+
+	if (sprites_.size() > capacity_) {
+		reserve_(graphicsDevice, std::max(sprites_.size(), capacity_ * 2u));
+	}
+
+	// group sprites by texture, keeping the order within groups
+	auto scratch = essentials::arena::ScratchScope();
+	auto textureOffsets = std::pmr::vector<size_t>(scratch.resource());
+	textureOffsets.reserve(textures_.size());
+	auto offset = size_t(0);
+	for (const auto& textureEntry : textures_) {
+		textureOffsets.emplace_back(offset);
+		offset += textureEntry.spriteCount;
+	}
+
+	sortedSprites_.resize(sprites_.size());
+	for (const auto& spriteEntry : sprites_) {
+		sortedSprites_[textureOffsets[spriteEntry.textureIdx]++] = spriteEntry.sprite;
+	}
+
+	const auto& spriteCommon = detail::SpriteCommon::reference();
+
+	auto sprite = sortedSprites_.cbegin();
+	for (const auto& textureEntry : textures_) {
+		auto& cmd = commandBuffer.create();
+
+		spriteCommon.setBatchState(cmd, *textureEntry.firstSprite, properties, renderControl);
+
+		const auto vertexCount = textureEntry.spriteCount * VERTICES_PER_SPRITE;
+		cmd.setVertexBuffer(
+			vertexBuffer_, vertexCount, sizeof(detail::SpriteCommon::Vertex), capacity_ * VERTICES_PER_SPRITE);
+		cmd.setIndexBuffer(indexBuffer_, textureEntry.spriteCount * INDICES_PER_SPRITE, sizeof(Index));
+		cmd.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_LIST);
+
+		// vertices are appended to the vertex buffer when the command is submitted
+		auto vertexData = cmd.allocateVertexData(vertexCount * sizeof(detail::SpriteCommon::Vertex));
+		auto* target = reinterpret_cast<detail::SpriteCommon::Vertex*>(vertexData.data());
+		for (auto spriteIdx = size_t(0); spriteIdx < textureEntry.spriteCount; ++spriteIdx, ++sprite) {
+			target = writeQuad(target, **sprite);
+		}
+	}
+
+	clear();
+}
+
+void SpriteBatch::clear() {
+	sprites_.clear();
+	textures_.clear();
+	sortedSprites_.clear();
+}
+
+void SpriteBatch::reserve_(graphics::Device& graphicsDevice, size_t capacity) {
+	vertexBuffer_ = createVertexBuffer(graphicsDevice, capacity);
+	indexBuffer_ = createIndexBuffer(graphicsDevice, capacity);
+	capacity_ = capacity;
+}
@@ -0,0 +1,94 @@
+#ifndef _DORMOUSEENGINE_RENDERER_D2_SPRITEBATCH_HPP_
+#define _DORMOUSEENGINE_RENDERER_D2_SPRITEBATCH_HPP_
+
+#include <vector>
+
+#include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "../command/commandfwd.hpp"
+#include "../control/controlfwd.hpp"
+#include "../control/ResourceView.hpp"
+#include "../shader/Property.hpp"
+#include "Sprite.hpp"
+
+namespace dormouse_engine::renderer::d2 {
+
+// Draws many sprites with one draw call per texture. Sprite quads are transformed on the CPU and stored in
+// the draw commands' data, each command appending its vertices to a shared dynamic vertex buffer when
+// submitted, which is discarded once per frame. Nothing is written to the GPU while recording, so batches
+// may be rendered on any thread. No per-sprite constant or instance data is uploaded.
+class SpriteBatch final {
+public:
+
+	static constexpr auto DEFAULT_CAPACITY = size_t(4096);
+
+	// Creates a batch with a vertex buffer for capacity sprites. The buffer grows if more sprites are rendered
+	// at once.
+	explicit SpriteBatch(graphics::Device& graphicsDevice, size_t capacity = DEFAULT_CAPACITY);
+
+	// Adds sprite to the batch. The sprite needs to stay alive until the batch is rendered.
+	void add(const Sprite& sprite);
+
+	// Records a draw command for each texture, in order of the textures' first use, then clears the batch.
+	// Sprites sharing a texture are drawn in the order in which they were added. graphicsDevice is only
+	// used to grow the batch's buffers.
+	void render(
+		graphics::Device& graphicsDevice,
+		command::CommandBuffer& commandBuffer,
+		const shader::Property& properties,
+		const control::Control& renderControl
+		);
+
+	void clear();
+
+	size_t size() const noexcept {
+		return sprites_.size();
+	}
+
+	size_t capacity() const noexcept {
+		return capacity_;
+	}
+
+private:
+
+	struct SpriteEntry {
+
+		const Sprite* sprite;
+
+		size_t textureIdx;
+
+	};
+
+	struct TextureEntry {
+
+		control::ResourceView texture;
+
+		const Sprite* firstSprite;
+
+		size_t spriteCount;
+
+	};
+
+	using SpriteEntries = std::vector<SpriteEntry>;
+
+	using TextureEntries = std::vector<TextureEntry>;
+
+	SpriteEntries sprites_;
+
+	TextureEntries textures_;
+
+	std::vector<const Sprite*> sortedSprites_;
+
+	graphics::Buffer vertexBuffer_;
+
+	graphics::Buffer indexBuffer_;
+
+	size_t capacity_ = 0u;
+
+	void reserve_(graphics::Device& graphicsDevice, size_t capacity);
+
+};
+
+} // namespace dormouse_engine::renderer::d2
+
+#endif /* _DORMOUSEENGINE_RENDERER_D2_SPRITEBATCH_HPP_ */
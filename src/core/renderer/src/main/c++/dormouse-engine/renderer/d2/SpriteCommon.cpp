@@ -0,0 +1,198 @@
+#include "SpriteCommon.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "dormouse-engine/graphics/ShaderCompiler.hpp"
+#include "dormouse-engine/graphics/ShaderDataType.hpp"
+#include "dormouse-engine/essentials/debug.hpp"
+#include "dormouse-engine/essentials/observer_ptr.hpp"
+#include "dormouse-engine/essentials/StringId.hpp"
+#include "../command/DrawCommand.hpp"
+#include "../control/Control.hpp"
+#include "../shader/MergedProperty.hpp"
+#include "../shader/NamedProperty.hpp"
+#include "Sprite.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+using namespace dormouse_engine::renderer::d2::detail;
+using namespace dormouse_engine::essentials::string_id_literals;
+
+const SpriteCommon::Quad& SpriteCommon::quad() noexcept {
+	static const auto QUAD = Quad{
+		Vertex{ { -1.0f, +1.0f }, { 0.0f, 0.0f } },
+		Vertex{ { +1.0f, +1.0f }, { 1.0f, 0.0f } },
+		Vertex{ { -1.0f, -1.0f }, { 0.0f, 1.0f } },
+		Vertex{ { +1.0f, -1.0f }, { 1.0f, 1.0f } }
+		};
+	return QUAD;
+}
+
+SpriteCommon::SpriteCommon(
+	graphics::Device& graphicsDevice,
+	essentials::ConstBufferView shaderCode,
+	shader::TechniqueCompiler& techniqueCompiler
+	) :
+	vertexBuffer_(createVertexBuffer_(graphicsDevice)),
+	indexBuffer_(createIndexBuffer_(graphicsDevice)),
+	instanceBuffer_(createInstanceBuffer_(graphicsDevice)),
+	technique_(createTechnique_(shaderCode, techniqueCompiler, "sprite", "vs")),
+	batchTechnique_(createTechnique_(shaderCode, techniqueCompiler, "sprite-batch", "vsBatch")),
+	sampler_(graphicsDevice, control::Sampler::CLAMPED_LINEAR),
+	renderState_(graphicsDevice, control::RenderState::OPAQUE),
+	viewConstants_(graphicsDevice, sizeof(math::Matrix4x4))
+{
+	setViewTransform(math::Transform());
+}
+
+void SpriteCommon::setViewTransform(const math::Transform& viewTransform) {
+	auto data = std::array<essentials::Byte, sizeof(math::Matrix4x4)>();
+	viewTransform.writeShaderData(
+		essentials::viewBuffer(data),
+		graphics::ShaderDataType(
+			graphics::ShaderDataType::Class::MATRIX_ROW_MAJOR, graphics::ShaderDataType::ScalarType::FLOAT, 4u, 4u)
+		);
+	viewConstants_.update(essentials::viewBuffer(data));
+}
+
+void SpriteCommon::setSpriteState(
+	command::DrawCommand& cmd,
+	const Sprite& sprite,
+	const shader::Property& properties,
+	const control::Control& renderControl
+	) const
+{
+	setState_(cmd, technique_, sprite, properties, renderControl);
+}
+
+void SpriteCommon::setBatchState(
+	command::DrawCommand& cmd,
+	const Sprite& sprite,
+	const shader::Property& properties,
+	const control::Control& renderControl
+	) const
+{
+	setState_(cmd, batchTechnique_, sprite, properties, renderControl);
+}
+
+void SpriteCommon::setInstanceData(
+	command::DrawCommand& cmd, const math::Transform& transform, const TextureRegion& region) const
+{
+	cmd.setInstanceBuffer(instanceBuffer_, INSTANCE_CAPACITY, INSTANCE_STRIDE);
+
+	auto instanceData = cmd.allocateInstanceData();
+	transform.writeShaderData(
+		instanceData,
+		graphics::ShaderDataType(
+			graphics::ShaderDataType::Class::MATRIX_ROW_MAJOR, graphics::ShaderDataType::ScalarType::FLOAT, 4u, 4u)
+		);
+
+	const auto regionData = math::Vec4(region.origin.x(), region.origin.y(), region.size.x(), region.size.y());
+	std::memcpy(instanceData.data() + sizeof(math::Matrix4x4), &regionData, sizeof(regionData));
+}
+
+void SpriteCommon::render(
+	command::DrawCommand& cmd,
+	const Sprite& sprite,
+	const shader::Property& properties,
+	const control::Control& renderControl
+	) const
+{
+	setSpriteState(cmd, sprite, properties, renderControl);
+
+	cmd.setVertexBuffer(vertexBuffer_, 4u, sizeof(Vertex));
+	cmd.setIndexBuffer(indexBuffer_, 4u, sizeof(std::uint16_t));
+	cmd.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+
+	// the transform is per-instance vertex data, so that sprites sharing a texture are batched
+	setInstanceData(cmd, sprite.layout().toNDC(), sprite.region());
+}
+
+graphics::Buffer SpriteCommon::createVertexBuffer_(graphics::Device& graphicsDevice) {
+	auto configuration = graphics::Buffer::Configuration();
+
+	const auto& initialData = quad();
+
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = false;
+	configuration.purpose = graphics::Buffer::CreationPurpose::VERTEX_BUFFER;
+	configuration.size = initialData.size() * sizeof(initialData.front());
+
+	return graphics::Buffer(graphicsDevice, std::move(configuration), essentials::viewBuffer(initialData));
+}
+
+graphics::Buffer SpriteCommon::createIndexBuffer_(graphics::Device& graphicsDevice) {
+	auto configuration = graphics::Buffer::Configuration();
+
+	const auto initialData = std::vector<std::uint16_t> { 0u, 1u, 2u, 3u };
+
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = false;
+	configuration.purpose = graphics::Buffer::CreationPurpose::INDEX_BUFFER;
+	configuration.size = initialData.size() * sizeof(initialData.front());
+
+	return graphics::Buffer(graphicsDevice, std::move(configuration), essentials::viewBuffer(initialData));
+}
+
+graphics::Buffer SpriteCommon::createInstanceBuffer_(graphics::Device& graphicsDevice) {
+	auto configuration = graphics::Buffer::Configuration();
+
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::VERTEX_BUFFER;
+	configuration.size = INSTANCE_CAPACITY * INSTANCE_STRIDE;
+
+	return graphics::Buffer(graphicsDevice, std::move(configuration));
+}
+
+shader::Technique SpriteCommon::createTechnique_(
+	essentials::ConstBufferView shaderCode,
+	shader::TechniqueCompiler& techniqueCompiler,
+	std::string name,
+	std::string vertexShaderEntrypoint
+	)
+{
+	auto description = shader::TechniqueCompiler::Description();
+	description.code = std::move(shaderCode);
+	description.name = std::move(name);
+	description.vertexShaderEntrypoint = std::move(vertexShaderEntrypoint);
+	description.pixelShaderEntrypoint = "ps";
+
+	if (essentials::IS_DEBUG) {
+		description.flags = graphics::ShaderCompiler::FULL_DEBUG_MASK;
+	}
+
+	auto technique = techniqueCompiler.compile(std::move(description)).get();
+	technique.setExternalConstantBuffer(graphics::ShaderType::VERTEX, VIEW_CONSTANTS_SLOT);
+	return technique;
+}
+
+void SpriteCommon::setState_(
+	command::DrawCommand& cmd,
+	const shader::Technique& technique,
+	const Sprite& sprite,
+	const shader::Property& properties,
+	const control::Control& renderControl
+	) const
+{
+	cmd.setRenderControl(renderControl);
+
+	auto spriteProperty = shader::Property(reflection::Object(essentials::make_observer(&sprite)));
+	auto spriteEntry = shader::Property(shader::NamedProperty("sprite"_sid, essentials::make_observer(&spriteProperty)));
+
+	auto mergedProperty = shader::MergedProperty(
+		essentials::make_observer(&spriteEntry),
+		essentials::make_observer(&properties)
+		);
+
+	technique.render(cmd, mergedProperty);
+
+	cmd.setTechnique(essentials::make_observer(&technique));
+	cmd.setSharedConstantBuffer(viewConstants_, graphics::ShaderType::VERTEX, VIEW_CONSTANTS_SLOT);
+}
@@ -0,0 +1,148 @@
+#ifndef _DORMOUSEENGINE_RENDERER_D2_SPRITECOMMON_HPP_
+#define _DORMOUSEENGINE_RENDERER_D2_SPRITECOMMON_HPP_
+
+#include <array>
+#include <string>
+
+#include "dormouse-engine/essentials/policy/creation/None.hpp"
+#include "dormouse-engine/essentials/Singleton.hpp"
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "dormouse-engine/math/Matrix.hpp"
+#include "dormouse-engine/math/Transform.hpp"
+#include "dormouse-engine/math/Vector.hpp"
+#include "../command/commandfwd.hpp"
+#include "../control/controlfwd.hpp"
+#include "../control/ConstantBuffer.hpp"
+#include "../control/Sampler.hpp"
+#include "../control/RenderState.hpp"
+#include "../shader/Property.hpp"
+#include "../shader/TechniqueCompiler.hpp"
+#include "../shader/Technique.hpp"
+#include "TextureRegion.hpp"
+
+namespace dormouse_engine::renderer::d2 {
+
+class Sprite;
+
+namespace detail {
+
+// Sprite techniques and geometry shared by Sprite and SpriteBatch. Sprite transforms and texture regions are
+// per-instance vertex data, so that consecutive sprites sharing a texture may be drawn with a single
+// instanced draw. Sprite batches draw vertices already transformed to NDC with a technique of their own,
+// which reads no instance data.
+class SpriteCommon final :
+	public essentials::Singleton<SpriteCommon, essentials::policy::creation::None<SpriteCommon>>
+{
+public:
+
+	struct Vertex {
+
+		math::Vec2 position;
+
+		math::Vec2 textureCoordinates;
+
+	};
+
+	using Quad = std::array<Vertex, 4>;
+
+	// Maximum number of sprites drawn with a single instanced draw call
+	static constexpr auto INSTANCE_CAPACITY = size_t(1024);
+
+	// Transform followed by the texture region, as origin and size
+	static constexpr auto INSTANCE_STRIDE = sizeof(math::Matrix4x4) + sizeof(math::Vec4);
+
+	// Quad vertices in model space, in triangle strip order
+	static const Quad& quad() noexcept;
+
+	SpriteCommon(
+		graphics::Device& graphicsDevice,
+		essentials::ConstBufferView shaderCode,
+		shader::TechniqueCompiler& techniqueCompiler
+		);
+
+	// Replaces the data of the view constant buffer, bound to every sprite command.
+	void setViewTransform(const math::Transform& viewTransform);
+
+	// Sets the render control, technique, the view constant buffer and the bindings of sprite's shader
+	// properties.
+	void setSpriteState(
+		command::DrawCommand& cmd,
+		const Sprite& sprite,
+		const shader::Property& properties,
+		const control::Control& renderControl
+		) const;
+
+	// As setSpriteState, but with the batch technique, whose vertices are in NDC and need no instance data.
+	void setBatchState(
+		command::DrawCommand& cmd,
+		const Sprite& sprite,
+		const shader::Property& properties,
+		const control::Control& renderControl
+		) const;
+
+	// Sets transform and texture region as the single instance data of cmd.
+	void setInstanceData(
+		command::DrawCommand& cmd, const math::Transform& transform, const TextureRegion& region) const;
+
+	void render(
+		command::DrawCommand& cmd,
+		const Sprite& sprite,
+		const shader::Property& properties,
+		const control::Control& renderControl
+		) const;
+
+	const control::Sampler& sampler() const {
+		return sampler_;
+	}
+
+private:
+
+	// register b0 of the vertex shader in sprite.hlsl
+	static constexpr auto VIEW_CONSTANTS_SLOT = size_t(0);
+
+	const graphics::Buffer vertexBuffer_;
+
+	const graphics::Buffer indexBuffer_;
+
+	const graphics::Buffer instanceBuffer_;
+
+	const shader::Technique technique_;
+
+	const shader::Technique batchTechnique_;
+
+	const control::Sampler sampler_;
+
+	const control::RenderState renderState_;
+
+	control::ConstantBuffer viewConstants_;
+
+	static graphics::Buffer createVertexBuffer_(graphics::Device& graphicsDevice);
+
+	static graphics::Buffer createIndexBuffer_(graphics::Device& graphicsDevice);
+
+	static graphics::Buffer createInstanceBuffer_(graphics::Device& graphicsDevice);
+
+	static shader::Technique createTechnique_(
+		essentials::ConstBufferView shaderCode,
+		shader::TechniqueCompiler& techniqueCompiler,
+		std::string name,
+		std::string vertexShaderEntrypoint
+		);
+
+	void setState_(
+		command::DrawCommand& cmd,
+		const shader::Technique& technique,
+		const Sprite& sprite,
+		const shader::Property& properties,
+		const control::Control& renderControl
+		) const;
+
+};
+
+} // namespace detail
+
+} // namespace dormouse_engine::renderer::d2
+
+#endif /* _DORMOUSEENGINE_RENDERER_D2_SPRITECOMMON_HPP_ */
@@ -0,0 +1,142 @@
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+#include "dormouse-engine/exceptions/RuntimeError.hpp"
+#include "SkylinePacker.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+namespace /* anonymous */ {
+
+graphics::PixelFormat commonPixelFormat(const std::vector<graphics::Image>& images) {
+	if (images.empty()) {
+		throw exceptions::LogicError("Can't build a texture atlas of no images");
+	}
+
+	const auto pixelFormat = images.front().pixelFormat();
+
+	if (pixelFormat.channel(0).type == graphics::PixelFormat::ChannelType::COMPRESSION_BLOCK) {
+		throw exceptions::LogicError("Block compressed images can't be packed into a texture atlas");
+	}
+
+	for (const auto& image : images) {
+		if (image.pixelFormat() != pixelFormat) {
+			throw exceptions::LogicError("All images packed into a texture atlas need to share a pixel format");
+		}
+
+		if (image.mipLevels() != 1u || image.arraySize() != 1u) {
+			throw exceptions::LogicError(
+				"Images packed into a texture atlas need to have a single mip level and array element");
+		}
+	}
+
+	return pixelFormat;
+}
+
+// Smallest power of two side of a square covering the padded images' area and their largest dimension
+size_t initialSize(const std::vector<SkylinePacker::Size>& sizes, size_t padding) {
+	auto area = size_t(0);
+	auto maxDimension = size_t(0);
+	for (const auto& size : sizes) {
+		area += (size.width + padding) * (size.height + padding);
+		maxDimension = std::max({ maxDimension, size.width, size.height });
+	}
+
+	auto side = size_t(1);
+	while (side * side < area || side < maxDimension) {
+		side *= 2u;
+	}
+
+	return side;
+}
+
+void blit(
+	essentials::ByteVector& target,
+	size_t targetRowPitch,
+	const graphics::Image& source,
+	const SkylinePacker::Rect& rect
+	)
+{
+	const auto pixelSize = source.pixelFormat().pixelSize();
+	const auto sourceRowPitch = source.pixelFormat().rowPitch(rect.width);
+	const auto sourcePixels = source.pixels();
+
+	assert(sourcePixels.size() >= sourceRowPitch * rect.height);
+
+	for (auto row = size_t(0); row < rect.height; ++row) {
+		std::memcpy(
+			target.data() + (rect.y + row) * targetRowPitch + rect.x * pixelSize,
+			sourcePixels.data() + row * sourceRowPitch,
+			rect.width * pixelSize
+			);
+	}
+}
+
+} // anonymous namespace
+
+TextureAtlas TextureAtlas::build(const std::vector<graphics::Image>& images, size_t maxSize, size_t padding) {
+	const auto pixelFormat = commonPixelFormat(images);
+
+	auto sizes = std::vector<SkylinePacker::Size>();
+	sizes.reserve(images.size());
+	for (const auto& image : images) {
+		sizes.emplace_back(SkylinePacker::Size{ image.size().first, image.size().second });
+	}
+
+	auto side = initialSize(sizes, padding);
+	for (;;) {
+		side = std::min(side, maxSize);
+
+		auto packer = SkylinePacker(side, side, padding);
+		const auto rects = packer.insert(sizes);
+
+		if (rects) {
+			const auto rowPitch = pixelFormat.rowPitch(side);
+			auto pixels = essentials::ByteVector(rowPitch * side);
+
+			auto regions = std::vector<TextureRegion>();
+			regions.reserve(images.size());
+
+			const auto toTextureCoordinates = [side](size_t texels) {
+					return static_cast<float>(texels) / static_cast<float>(side);
+				};
+
+			for (auto imageIdx = size_t(0); imageIdx < images.size(); ++imageIdx) {
+				const auto& rect = (*rects)[imageIdx];
+
+				blit(pixels, rowPitch, images[imageIdx], rect);
+
+				auto region = TextureRegion();
+				region.origin = math::Vec2(toTextureCoordinates(rect.x), toTextureCoordinates(rect.y));
+				region.size = math::Vec2(toTextureCoordinates(rect.width), toTextureCoordinates(rect.height));
+				regions.emplace_back(region);
+			}
+
+			return TextureAtlas(
+				graphics::Image(std::move(pixels), graphics::Image::Dimensions(side, side), 1u, 1u, pixelFormat),
+				std::move(regions),
+				packer.occupancy()
+				);
+		}
+
+		if (side == maxSize) {
+			throw exceptions::RuntimeError(
+				"Images don't fit in a " + std::to_string(maxSize) + "x" + std::to_string(maxSize) + " texture atlas");
+		}
+
+		side *= 2u;
+	}
+}
+
+TextureAtlas::TextureAtlas(graphics::Image image, std::vector<TextureRegion> regions, float occupancy) :
+	image_(std::move(image)),
+	regions_(std::move(regions)),
+	occupancy_(occupancy)
+{
+}
@@ -0,0 +1,65 @@
+#ifndef _DORMOUSEENGINE_RENDERER_D2_TEXTUREATLAS_HPP_
+#define _DORMOUSEENGINE_RENDERER_D2_TEXTUREATLAS_HPP_
+
+#include <cassert>
+#include <vector>
+
+#include "dormouse-engine/graphics/Image.hpp"
+#include "TextureRegion.hpp"
+
+namespace dormouse_engine::renderer::d2 {
+
+// Image with many smaller images packed into it, so that sprites using any of them share a single texture
+// and may be drawn together. Create the texture from image() and the sprites with the regions of their
+// images.
+class TextureAtlas final {
+public:
+
+	static constexpr auto DEFAULT_MAX_SIZE = size_t(4096);
+
+	// Gap between packed images, so that linear filtering doesn't sample neighbouring images
+	static constexpr auto DEFAULT_PADDING = size_t(1);
+
+	// Packs images into the smallest square, power-of-two atlas that fits them, but no larger than maxSize.
+	// The images need to share an uncompressed pixel format and have a single mip level and array element.
+	// Throws exceptions::RuntimeError if the images don't fit.
+	static TextureAtlas build(
+		const std::vector<graphics::Image>& images,
+		size_t maxSize = DEFAULT_MAX_SIZE,
+		size_t padding = DEFAULT_PADDING
+		);
+
+	const graphics::Image& image() const noexcept {
+		return image_;
+	}
+
+	// Region of the image at imageIdx of the images the atlas was built from.
+	const TextureRegion& region(size_t imageIdx) const noexcept {
+		assert(imageIdx < regions_.size());
+		return regions_[imageIdx];
+	}
+
+	const std::vector<TextureRegion>& regions() const noexcept {
+		return regions_;
+	}
+
+	// Fraction of the atlas covered by the packed images.
+	float occupancy() const noexcept {
+		return occupancy_;
+	}
+
+private:
+
+	graphics::Image image_;
+
+	std::vector<TextureRegion> regions_;
+
+	float occupancy_;
+
+	TextureAtlas(graphics::Image image, std::vector<TextureRegion> regions, float occupancy);
+
+};
+
+} // namespace dormouse_engine::renderer::d2
+
+#endif /* _DORMOUSEENGINE_RENDERER_D2_TEXTUREATLAS_HPP_ */
@@ -0,0 +1,27 @@
+#ifndef _DORMOUSEENGINE_RENDERER_D2_TEXTUREREGION_HPP_
+#define _DORMOUSEENGINE_RENDERER_D2_TEXTUREREGION_HPP_
+
+#include "dormouse-engine/math/Vector.hpp"
+
+namespace dormouse_engine::renderer::d2 {
+
+// Rectangle of a texture, in texture coordinates. Defaults to the whole texture.
+struct TextureRegion {
+
+	math::Vec2 origin = math::Vec2(0.0f, 0.0f);
+
+	math::Vec2 size = math::Vec2(1.0f, 1.0f);
+
+	// Maps coordinates relative to the region to coordinates in the texture.
+	math::Vec2 map(const math::Vec2& textureCoordinates) const noexcept {
+		return math::Vec2(
+			origin.x() + textureCoordinates.x() * size.x(),
+			origin.y() + textureCoordinates.y() * size.y()
+			);
+	}
+
+};
+
+} // namespace dormouse_engine::renderer::d2
+
+#endif /* _DORMOUSEENGINE_RENDERER_D2_TEXTUREREGION_HPP_ */
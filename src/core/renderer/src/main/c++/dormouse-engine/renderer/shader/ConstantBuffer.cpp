@@ -1,25 +1,12 @@
 #include "ConstantBuffer.hpp"
 
 #include "../command/DrawCommand.hpp"
+#include "../control/ConstantBuffer.hpp"
 
 using namespace dormouse_engine;
 using namespace dormouse_engine::renderer;
 using namespace dormouse_engine::renderer::shader;
 
-namespace /* anonymous */ {
-
-graphics::Buffer createConstantBuffer(graphics::Device& graphicsDevice, size_t size) {
-	auto configuration = graphics::Buffer::Configuration();
-	configuration.allowCPURead = false;
-	configuration.allowGPUWrite = false;
-	configuration.allowModifications = true;
-	configuration.purpose = graphics::Buffer::CreationPurpose::CONSTANT_BUFFER;
-	configuration.size = size;
-	return graphics::Buffer(graphicsDevice, configuration);
-}
-
-} // anonymous namespace
-
 ConstantBuffer::ConstantBuffer(
 	graphics::Device& graphicsDevice,
 	graphics::ShaderType stage,
@@ -27,11 +14,11 @@ ConstantBuffer::ConstantBuffer(
 	size_t size,
 	Parameters parameters
 	) :
-	buffer_(createConstantBuffer(graphicsDevice, size)),
+	buffer_(control::createConstantBuffer(graphicsDevice, size)),
 	stage_(stage),
 	slot_(slot),
 	size_(size),
-	parameters_(std::move(parameters))
+	layout_(parameters)
 {
 }
 
@@ -39,10 +26,7 @@ ConstantBuffer::ConstantBuffer(
 void ConstantBuffer::bind(command::DrawCommand& drawCommand, const Property& root) const {
 	drawCommand.setConstantBuffer(buffer_, stage_, slot_);
 
-	auto& buffer = drawCommand.constantBufferData(stage_, slot_);
-	buffer.resize(size_);
+	const auto buffer = drawCommand.allocateConstantBufferData(stage_, slot_, size_);
 
-	for (const auto& parameter : parameters_) {
-		parameter.write(essentials::viewBuffer(buffer), root);
-	}
+	layout_.write(buffer, root);
 }
@@ -8,6 +8,7 @@
 #include "dormouse-engine/graphics/ShaderType.hpp"
 #include "dormouse-engine/graphics/Buffer.hpp"
 #include "../command/commandfwd.hpp"
+#include "ConstantBufferLayout.hpp"
 #include "Parameter.hpp"
 
 namespace dormouse_engine::renderer::shader {
@@ -29,6 +30,14 @@ public:
 
 	void bind(command::DrawCommand& drawCommand, const Property& root) const;
 
+	graphics::ShaderType stage() const noexcept {
+		return stage_;
+	}
+
+	size_t slot() const noexcept {
+		return slot_;
+	}
+
 private:
 
 	graphics::Buffer buffer_;
@@ -39,7 +48,7 @@ private:
 
 	size_t size_;
 
-	Parameters parameters_;
+	ConstantBufferLayout layout_;
 
 };
 
@@ -0,0 +1,133 @@
+#include "ConstantBufferLayout.hpp"
+
+#include <array>
+#include <algorithm>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+#include "dormouse-engine/essentials/Range.hpp"
+#include "Property.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+// Properties reachable from the root, with array elements as separate nodes
+struct PropertyNode {
+
+	essentials::StringId name;
+
+	size_t arrayIdx;
+
+	PropertyDescriptor::Objects path;
+
+	std::vector<PropertyNode> children;
+
+	std::vector<std::tuple<size_t, graphics::ShaderDataType>> writes;
+
+	PropertyNode& child(const PropertyDescriptor::Object& object, size_t idx) {
+		auto it = std::find_if(children.begin(), children.end(), [&](const PropertyNode& node) {
+				return node.name == object.name && node.arrayIdx == idx;
+			});
+
+		if (it == children.end()) {
+			auto node = PropertyNode();
+			node.name = object.name;
+			node.arrayIdx = idx;
+			node.path = path;
+			node.path.emplace_back(object.name);
+			children.emplace_back(std::move(node));
+			return children.back();
+		}
+
+		return *it;
+	}
+
+};
+
+void addParameter(
+	PropertyNode& node,
+	PropertyId id,
+	size_t offset,
+	const graphics::ShaderDataType& dataType
+	)
+{
+	if (id.empty()) {
+		node.writes.emplace_back(offset, dataType);
+		return;
+	}
+
+	const auto& head = id.head();
+	for (auto idx : essentials::range<size_t>(0u, std::max<size_t>(1u, head.arraySize))) {
+		addParameter(node.child(head, idx), id.tail(), offset + idx * head.arrayElementOffset, dataType);
+	}
+}
+
+void emitOperations(const PropertyNode& node, size_t depth, ConstantBufferLayout::Operations& operations) {
+	if (depth >= ConstantBufferLayout::MAX_PROPERTY_DEPTH) {
+		throw exceptions::LogicError(
+			"Constant buffer parameters nested deeper than " +
+			std::to_string(ConstantBufferLayout::MAX_PROPERTY_DEPTH) +
+			" properties are not supported"
+			);
+	}
+
+	for (const auto& [offset, dataType] : node.writes) {
+		auto operation = ConstantBufferLayout::Operation();
+		operation.type = ConstantBufferLayout::Operation::Type::WRITE;
+		operation.depth = depth;
+		operation.offset = offset;
+		operation.dataType = dataType;
+		operations.emplace_back(std::move(operation));
+	}
+
+	for (const auto& child : node.children) {
+		auto operation = ConstantBufferLayout::Operation();
+		operation.type = ConstantBufferLayout::Operation::Type::RESOLVE;
+		operation.depth = depth;
+		operation.name = child.name;
+		operation.arrayIdx = child.arrayIdx;
+		operation.descriptor = PropertyDescriptor(child.path);
+		operations.emplace_back(std::move(operation));
+
+		emitOperations(child, depth + 1, operations);
+	}
+}
+
+} // anonymous namespace
+
+ConstantBufferLayout::ConstantBufferLayout(const std::vector<Parameter>& parameters) {
+	auto root = PropertyNode();
+
+	for (const auto& parameter : parameters) {
+		auto id = PropertyId(parameter.propertyDescriptor());
+		assert(!id.empty());
+		addParameter(root, id, parameter.offset(), parameter.dataType());
+	}
+
+	emitOperations(root, 0u, operations_);
+}
+
+void ConstantBufferLayout::write(essentials::BufferView buffer, const Property& root) const {
+	// Resolved properties by depth, the root being at 0. Operations are emitted depth-first, so the
+	// property at a given depth is always the one on the path of the current operation.
+	auto properties = std::array<Property, MAX_PROPERTY_DEPTH>();
+	properties[0] = root;
+
+	for (const auto& operation : operations_) {
+		const auto& property = properties[operation.depth];
+
+		switch (operation.type) {
+		case Operation::Type::RESOLVE:
+			if (!property.has(operation.name, operation.arrayIdx)) {
+				throw PropertyNotBound(operation.descriptor);
+			}
+			properties[operation.depth + 1] = property.get(operation.name, operation.arrayIdx);
+			break;
+		case Operation::Type::WRITE:
+			property.write(buffer + operation.offset, operation.dataType);
+			break;
+		}
+	}
+}
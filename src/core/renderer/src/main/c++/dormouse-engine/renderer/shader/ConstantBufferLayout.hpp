@@ -0,0 +1,69 @@
+#ifndef _DORMOUSEENGINE_RENDERER_SHADER_CONSTANTBUFFERLAYOUT_HPP_
+#define _DORMOUSEENGINE_RENDERER_SHADER_CONSTANTBUFFERLAYOUT_HPP_
+
+#include <vector>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/essentials/StringId.hpp"
+#include "dormouse-engine/graphics/ShaderDataType.hpp"
+#include "Parameter.hpp"
+#include "PropertyId.hpp"
+
+namespace dormouse_engine::renderer::shader {
+
+class Property;
+
+// Parameters of a constant buffer compiled into a flat list of operations. Each property on the parameters'
+// paths is resolved once per write, even if shared by many parameters (e.g. "sprite" in "sprite_transform" and
+// "sprite_textureRegion"), and arrays are unrolled, so writing walks no property descriptors.
+class ConstantBufferLayout {
+public:
+
+	// Nesting limit of parameter properties, starting at the constant buffer itself.
+	static constexpr auto MAX_PROPERTY_DEPTH = size_t(8);
+
+	struct Operation {
+
+		enum class Type {
+			RESOLVE, // property at depth + 1 = get(name, arrayIdx) of property at depth
+			WRITE, // write property at depth to the buffer at offset as dataType
+		};
+
+		Type type;
+
+		size_t depth;
+
+		essentials::StringId name;
+
+		size_t arrayIdx = 0u;
+
+		size_t offset = 0u;
+
+		graphics::ShaderDataType dataType;
+
+		// Path of the resolved property, reported if it's not bound
+		PropertyDescriptor descriptor;
+
+	};
+
+	using Operations = std::vector<Operation>;
+
+	ConstantBufferLayout() = default;
+
+	explicit ConstantBufferLayout(const std::vector<Parameter>& parameters);
+
+	void write(essentials::BufferView buffer, const Property& root) const;
+
+	const Operations& operations() const noexcept {
+		return operations_;
+	}
+
+private:
+
+	Operations operations_;
+
+};
+
+} // namespace dormouse_engine::renderer::shader
+
+#endif /* _DORMOUSEENGINE_RENDERER_SHADER_CONSTANTBUFFERLAYOUT_HPP_ */
@@ -1,10 +1,19 @@
 #include "InputLayout.hpp"
 
+#include <string>
+
 using namespace dormouse_engine;
 using namespace dormouse_engine::renderer::shader;
 
 namespace /*anonymous */ {
 
+// Vertex shader inputs with semantics starting with this prefix are read per-instance, from input slot 1
+const auto INSTANCE_SEMANTIC_PREFIX = std::string("INSTANCE_");
+
+bool isPerInstance(const std::string& semantic) {
+	return semantic.compare(0u, INSTANCE_SEMANTIC_PREFIX.size(), INSTANCE_SEMANTIC_PREFIX) == 0;
+}
+
 graphics::PixelFormat::DataType elementDataType(
 	graphics::ShaderReflection::InputParameterInfo::DataType inputDataType)
 {
@@ -21,14 +30,8 @@ graphics::PixelFormat::DataType elementDataType(
 	return graphics::PixelFormat::DataType::UNKNOWN;
 }
 
-graphics::InputLayout::Elements deduceInputLayoutElements(
-	essentials::ConstBufferView compiledVertexShaderObjectData
-	)
-{
+graphics::InputLayout::Elements deduceInputLayoutElements(const graphics::ShaderReflection& reflectionData) {
 	auto elements = graphics::InputLayout::Elements();
-	const auto reflectionData = graphics::ShaderReflection( // TODO: ShaderReflection constructor should accept ConstBufferView
-		compiledVertexShaderObjectData.data(), compiledVertexShaderObjectData.size());
-
 	elements.reserve(reflectionData.inputParameters().size());
 
 	for (const auto& inputParameter : reflectionData.inputParameters()) {
@@ -54,13 +57,23 @@ graphics::InputLayout::Elements deduceInputLayoutElements(
 				graphics::PixelFormat::Channel(graphics::PixelFormat::ChannelType::W, dataType, 32u);
 		}
 
-		elements.emplace_back(
-			inputParameter.semantic,
-			inputParameter.semanticIndex,
-			format,
-			graphics::InputLayout::SlotType::PER_VERTEX_DATA, // TODO: temp
-			0u
-			);
+		if (isPerInstance(inputParameter.semantic)) {
+			elements.emplace_back(
+				inputParameter.semantic,
+				inputParameter.semanticIndex,
+				format,
+				graphics::InputLayout::SlotType::PER_INSTANCE_DATA,
+				1u
+				);
+		} else {
+			elements.emplace_back(
+				inputParameter.semantic,
+				inputParameter.semanticIndex,
+				format,
+				graphics::InputLayout::SlotType::PER_VERTEX_DATA,
+				0u
+				);
+		}
 	}
 
 	return elements;
@@ -72,7 +85,18 @@ InputLayout::InputLayout(
 	graphics::Device& graphicsDevice,
 	essentials::ConstBufferView compiledVertexShaderObjectData
 	) :
-	inputLayout_(graphicsDevice, deduceInputLayoutElements(compiledVertexShaderObjectData))
+	inputLayout_(
+		graphicsDevice,
+		deduceInputLayoutElements(graphics::ShaderReflection( // TODO: ShaderReflection constructor should accept ConstBufferView
+			compiledVertexShaderObjectData.data(), compiledVertexShaderObjectData.size())))
+{
+}
+
+InputLayout::InputLayout(
+	graphics::Device& graphicsDevice,
+	const graphics::ShaderReflection& vertexShaderReflectionData
+	) :
+	inputLayout_(graphicsDevice, deduceInputLayoutElements(vertexShaderReflectionData))
 {
 }
 
@@ -18,6 +18,11 @@ public:
 		essentials::ConstBufferView compiledVertexShaderObjectData
 		);
 
+	InputLayout(
+		graphics::Device& graphicsDevice,
+		const graphics::ShaderReflection& vertexShaderReflectionData
+		);
+
 	InputLayout(
 		graphics::Device& graphicsDevice,
 		const graphics::InputLayout::Elements& elements
@@ -1,15 +1,13 @@
 #ifndef _DORMOUSEENGINE_RENDERER_SHADER_PARAMETER_HPP_
 #define _DORMOUSEENGINE_RENDERER_SHADER_PARAMETER_HPP_
 
-#include "dormouse-engine/essentials/memory.hpp"
 #include "dormouse-engine/graphics/ShaderDataType.hpp"
-#include "dormouse-engine/graphics/PixelFormat.hpp"
 #include "PropertyId.hpp"
 
 namespace dormouse_engine::renderer::shader {
 
-class Property;
-
+// A constant buffer variable, as reflected from a shader. Parameters are compiled into a
+// ConstantBufferLayout, which writes them.
 class Parameter {
 public:
 
@@ -20,7 +18,17 @@ public:
 	{
 	}
 
-	void write(essentials::BufferView buffer, const Property& root) const;
+	const PropertyDescriptor& propertyDescriptor() const noexcept {
+		return propertyDescriptor_;
+	}
+
+	const graphics::ShaderDataType& dataType() const noexcept {
+		return dataType_;
+	}
+
+	size_t offset() const noexcept {
+		return offset_;
+	}
 
 private:
 
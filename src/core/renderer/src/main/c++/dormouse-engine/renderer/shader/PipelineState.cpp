@@ -0,0 +1,95 @@
+#include "PipelineState.hpp"
+
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "dormouse-engine/essentials/Singleton.hpp"
+#include "dormouse-engine/essentials/hash-combine.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+class PipelineStateFactory final :
+	public essentials::Singleton<PipelineStateFactory>
+{
+public:
+
+	using Key = std::pair<const Technique*, size_t>;
+
+	struct Instance {
+
+		const Technique* technique;
+
+		control::RenderState renderState;
+
+	};
+
+	PipelineState::Id create(const Technique& technique, const control::RenderState& renderState) {
+		auto lock = std::unique_lock<std::mutex>(mutex_);
+
+		auto it = index_.find(Key(&technique, renderState.id()));
+
+		if (it == index_.end()) {
+			assert(instances_.size() < static_cast<size_t>(static_cast<PipelineState::Id>(-1)));
+			it = index_.emplace_hint(
+				it, Key(&technique, renderState.id()), static_cast<PipelineState::Id>(instances_.size()));
+			instances_.emplace_back(Instance{ &technique, renderState });
+		}
+
+		return it->second;
+	}
+
+	Instance get(PipelineState::Id id) const {
+		auto lock = std::unique_lock<std::mutex>(mutex_);
+
+		assert(id < instances_.size());
+		return instances_[id];
+	}
+
+private:
+
+	struct KeyHash {
+
+		size_t operator()(const Key& key) const {
+			auto seed = std::hash<const Technique*>()(key.first);
+			seed = essentials::hashCombine(seed, key.second);
+			return seed;
+		}
+
+	};
+
+	using Index = std::unordered_map<Key, PipelineState::Id, KeyHash>;
+
+	using Instances = std::deque<Instance>;
+
+	mutable std::mutex mutex_;
+
+	Index index_;
+
+	Instances instances_;
+
+};
+
+} // anonymous namespace
+
+PipelineState::PipelineState(const Technique& technique, const control::RenderState& renderState) :
+	pipelineStateId_(PipelineStateFactory::reference().create(technique, renderState))
+{
+}
+
+const Technique& PipelineState::technique() const {
+	assert(pipelineStateId_ != INVALID_PIPELINE_STATE_ID);
+	return *PipelineStateFactory::reference().get(pipelineStateId_).technique;
+}
+
+control::RenderState PipelineState::renderState() const {
+	assert(pipelineStateId_ != INVALID_PIPELINE_STATE_ID);
+	return PipelineStateFactory::reference().get(pipelineStateId_).renderState;
+}
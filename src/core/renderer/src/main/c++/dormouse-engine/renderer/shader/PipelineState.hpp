@@ -0,0 +1,54 @@
+#ifndef _DORMOUSEENGINE_RENDERER_SHADER_PIPELINESTATE_HPP_
+#define _DORMOUSEENGINE_RENDERER_SHADER_PIPELINESTATE_HPP_
+
+#include <cstdint>
+
+#include "../control/RenderState.hpp"
+#include "Technique.hpp"
+
+namespace dormouse_engine::renderer::shader {
+
+// Combination of the pipeline configuration of a draw: the technique's input layout and shaders and the
+// render state. Combinations are interned on construction, so a pipeline state is a small id, precomputed
+// when a command is recorded and compared as a unit when it's bound - see command::StateCache.
+// The technique needs to outlive all pipeline states referencing it. Safe to create from multiple threads.
+class PipelineState final {
+public:
+
+	using Id = std::uint32_t;
+
+	PipelineState() = default;
+
+	PipelineState(const Technique& technique, const control::RenderState& renderState);
+
+	const Technique& technique() const;
+
+	control::RenderState renderState() const;
+
+	Id id() const noexcept {
+		return pipelineStateId_;
+	}
+
+	explicit operator bool() const noexcept {
+		return pipelineStateId_ != INVALID_PIPELINE_STATE_ID;
+	}
+
+private:
+
+	static constexpr auto INVALID_PIPELINE_STATE_ID = static_cast<Id>(-1);
+
+	Id pipelineStateId_ = INVALID_PIPELINE_STATE_ID;
+
+	friend bool operator==(const PipelineState& lhs, const PipelineState& rhs) noexcept {
+		return lhs.pipelineStateId_ == rhs.pipelineStateId_;
+	}
+
+	friend bool operator!=(const PipelineState& lhs, const PipelineState& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+};
+
+} // namespace dormouse_engine::renderer::shader
+
+#endif /* _DORMOUSEENGINE_RENDERER_SHADER_PIPELINESTATE_HPP_ */
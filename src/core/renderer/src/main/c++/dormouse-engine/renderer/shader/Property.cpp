@@ -1,5 +1,9 @@
 #include "Property.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
 #pragma warning(push, 3)
 #	include <ponder/valuevisitor.hpp>
 #	include <ponder/classvisitor.hpp>
@@ -7,6 +11,7 @@
 #	include <ponder/uses/runtime.hpp>
 #pragma warning(pop)
 
+#include "dormouse-engine/essentials/hash-combine.hpp"
 #include "dormouse-engine/essentials/observer_ptr.hpp"
 #include "dormouse-engine/exceptions/LogicError.hpp"
 #include "dormouse-engine/exceptions/RuntimeError.hpp"
@@ -28,8 +33,35 @@ public:
 		return essentials::make_observer(&v);
 	}
 
-	Property operator()([[maybe_unused]] const ponder::UserObject& uo) {
-		return reflection::Object(uo);
+	// ponder stores numbers as long and double, which are stored in the property as their shader types
+
+	Property operator()(bool b) {
+		return static_cast<int>(b);
+	}
+
+	Property operator()(long l) {
+		return static_cast<int>(l);
+	}
+
+	Property operator()(double d) {
+		return static_cast<float>(d);
+	}
+
+	// Matrices and transforms are copied into the property to be written directly instead of through
+	// their reflected writeShaderData functions
+	Property operator()(const ponder::UserObject& uo) {
+		static const auto& matrixClass = ponder::classByType<math::Matrix4x4>();
+		static const auto& transformClass = ponder::classByType<math::Transform>();
+
+		const auto& metaclass = uo.getClass();
+
+		if (&metaclass == &matrixClass) {
+			return uo.get<math::Matrix4x4>();
+		} else if (&metaclass == &transformClass) {
+			return uo.get<math::Transform>();
+		} else {
+			return reflection::Object(uo);
+		}
 	}
 
 };
@@ -54,9 +86,9 @@ public:
 					function.name()
 					);
 			}
-		}
 
-		function_ = essentials::make_observer(&function);
+			function_ = essentials::make_observer(&function);
+		}
 	}
 
 	essentials::observer_ptr<const ponder::Function> function() const {
@@ -71,6 +103,143 @@ private:
 
 };
 
+// Properties of reflected classes by name. Resolving a property through ponder requires the name string,
+// which costs a lookup in the StringId registry and another in the class's property table, so each
+// (class, name) pair is looked up once and the result, including absence, stored under its hash.
+class PropertyLookup {
+public:
+
+	const ponder::Property* find(const ponder::Class& metaclass, essentials::StringId id) {
+		const auto key = Key{ &metaclass, id };
+		auto it = properties_.find(key);
+
+		if (it == properties_.end()) {
+			const auto& idString = id.string();
+			const auto* property = metaclass.hasProperty(idString) ? &metaclass.property(idString) : nullptr;
+			it = properties_.emplace(key, property).first;
+		}
+
+		return it->second;
+	}
+
+private:
+
+	struct Key {
+
+		const ponder::Class* metaclass;
+
+		essentials::StringId id;
+
+		friend bool operator==(const Key& lhs, const Key& rhs) noexcept {
+			return lhs.metaclass == rhs.metaclass && lhs.id == rhs.id;
+		}
+
+	};
+
+	struct KeyHash {
+
+		size_t operator()(const Key& key) const noexcept {
+			return essentials::hashCombine(
+				std::hash<const ponder::Class*>()(key.metaclass),
+				std::hash<essentials::StringId>()(key.id)
+				);
+		}
+
+	};
+
+	std::unordered_map<Key, const ponder::Property*, KeyHash> properties_;
+
+};
+
+// Commands may be recorded on many threads, so each has its own lookup table instead of sharing a locked one
+const ponder::Property* findProperty(const ponder::Class& metaclass, essentials::StringId id) {
+	thread_local auto lookup = PropertyLookup();
+	return lookup.find(metaclass, std::move(id));
+}
+
+// Functions of reflected classes by tag. Finding one requires visiting all functions of the class, so
+// it's done once per class and tag, and the result stored.
+class TaggedFunctionLookup {
+public:
+
+	const ponder::Function& find(
+		const ponder::Class& metaclass,
+		reflection::ClassTag requiredClassTag,
+		reflection::FunctionTag requiredFunctionTag
+		)
+	{
+		const auto key = Key{ &metaclass, requiredFunctionTag };
+		auto it = functions_.find(key);
+
+		if (it == functions_.end()) {
+			it = functions_.emplace(key, &findFunction_(metaclass, requiredClassTag, requiredFunctionTag)).first;
+		}
+
+		return *it->second;
+	}
+
+private:
+
+	struct Key {
+
+		const ponder::Class* metaclass;
+
+		reflection::FunctionTag functionTag;
+
+		friend bool operator==(const Key& lhs, const Key& rhs) noexcept {
+			return lhs.metaclass == rhs.metaclass && lhs.functionTag == rhs.functionTag;
+		}
+
+	};
+
+	struct KeyHash {
+
+		size_t operator()(const Key& key) const noexcept {
+			return essentials::hashCombine(
+				std::hash<const ponder::Class*>()(key.metaclass),
+				static_cast<size_t>(key.functionTag)
+				);
+		}
+
+	};
+
+	std::unordered_map<Key, const ponder::Function*, KeyHash> functions_;
+
+	static const ponder::Function& findFunction_(
+		const ponder::Class& metaclass,
+		reflection::ClassTag requiredClassTag,
+		reflection::FunctionTag requiredFunctionTag
+		)
+	{
+		if (!metaclass.hasTag(requiredClassTag)) {
+			throw exceptions::RuntimeError(
+				"Class " +
+				metaclass.name() +
+				" is not tagged as " +
+				toString(requiredClassTag)
+				);
+		}
+
+		auto binderVisitor = FunctionFindingVisitor(requiredFunctionTag);
+		metaclass.visit(binderVisitor);
+
+		auto functionPtr = binderVisitor.function();
+		if (!functionPtr) {
+			throw exceptions::LogicError(
+				"Class " +
+				metaclass.name() +
+				" tagged as " +
+				toString(requiredClassTag) +
+				" has no functions tagged as " +
+				toString(requiredFunctionTag)
+				);
+		}
+
+		return *functionPtr;
+	}
+
+};
+
 template <class... ArgTypes>
 void findAndCallTagged(
 	reflection::Object reflectionObject,
@@ -79,52 +248,66 @@ void findAndCallTagged(
 	ArgTypes&&... args
 	)
 {
-	const auto& metaclass = reflectionObject.metaclass();
-
-	if (!metaclass.hasTag(requiredClassTag)) {
-		throw exceptions::RuntimeError(
-			"Class " +
-			metaclass.name() +
-			" is not tagged as " +
-			toString(requiredClassTag)
-			);
-	}
+	thread_local auto lookup = TaggedFunctionLookup();
+	const auto& function = lookup.find(reflectionObject.metaclass(), requiredClassTag, requiredFunctionTag);
 
-	auto binderVisitor = FunctionFindingVisitor(requiredFunctionTag);
-	metaclass.visit(binderVisitor);
-
-	auto functionPtr = binderVisitor.function();
-	if (!functionPtr) {
-		throw exceptions::LogicError(
-			"Class " +
-			metaclass.name() +
-			" tagged as " +
-			toString(requiredClassTag) +
-			" has no functions tagged as " +
-			toString(requiredFunctionTag)
-			);
-	}
-
-	const auto functionKind = functionPtr->kind();
+	const auto functionKind = function.kind();
 	if (
 		functionKind == ponder::FunctionKind::MemberFunction ||
 		functionKind == ponder::FunctionKind::MemberObject
 		)
 	{
 		ponder::runtime::call(
-			*functionPtr,
+			function,
 			reflectionObject.metaobject(),
 			std::forward<ArgTypes>(args)...
 		);
 	} else {
 		ponder::runtime::callStatic(
-			*functionPtr,
+			function,
 			reflectionObject.metaobject(),
 			std::forward<ArgTypes>(args)...
 			);
 	}
 }
 
+template <class T>
+void writeScalar(T value, essentials::BufferView buffer, graphics::ShaderDataType dataType) {
+	switch (dataType.scalarType) {
+	case graphics::ShaderDataType::ScalarType::FLOAT: {
+		const auto converted = static_cast<float>(value);
+		std::memcpy(buffer.data(), &converted, sizeof(converted));
+		break;
+	}
+	case graphics::ShaderDataType::ScalarType::INT: {
+		const auto converted = static_cast<std::int32_t>(value);
+		std::memcpy(buffer.data(), &converted, sizeof(converted));
+		break;
+	}
+	case graphics::ShaderDataType::ScalarType::UINT: {
+		const auto converted = static_cast<std::uint32_t>(value);
+		std::memcpy(buffer.data(), &converted, sizeof(converted));
+		break;
+	}
+	case graphics::ShaderDataType::ScalarType::BOOL: {
+		const auto converted = static_cast<std::uint32_t>(value != T(0));
+		std::memcpy(buffer.data(), &converted, sizeof(converted));
+		break;
+	}
+	default:
+		throw IncompatibleDataType("Scalars are not writeable to scalar type " + toString(dataType.scalarType));
+	}
+}
+
+template <class VectorType>
+void writeVector(const VectorType& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType) {
+	if (dataType.scalarType != graphics::ShaderDataType::ScalarType::FLOAT) {
+		throw IncompatibleDataType("Vectors are not writeable to scalar type " + toString(dataType.scalarType));
+	}
+
+	std::memcpy(buffer.data(), &vector, sizeof(vector));
+}
+
 } // anonymous namespace
 
 bool shader::hasShaderProperty(
@@ -133,10 +316,7 @@ bool shader::hasShaderProperty(
 	[[maybe_unused]] size_t arrayIdx
 	)
 {
-	const auto& metaclass = reflectionObject.metaclass();
-	const auto& idString = id.string();
-	
-	return metaclass.hasProperty(idString);
+	return findProperty(reflectionObject.metaclass(), std::move(id)) != nullptr;
 }
 
 Property shader::getShaderProperty(
@@ -145,12 +325,11 @@ Property shader::getShaderProperty(
 	[[maybe_unused]] size_t arrayIdx
 	)
 {
-	const auto& metaclass = reflectionObject.metaclass();
+	const auto* property = findProperty(reflectionObject.metaclass(), std::move(id));
 
-	assert(hasShaderProperty(reflectionObject, id, arrayIdx));
+	assert(property);
 
-	const auto& property = metaclass.property(id.string());
-	const auto& value = property.get(reflectionObject.metaobject());
+	const auto& value = property->get(reflectionObject.metaobject());
 
 	return value.visit(ShaderPropertyVisitor());
 }
@@ -186,3 +365,29 @@ void shader::writeShaderData(
 		ponder::UserObject::makeRef(dataType)
 		);
 }
+
+void shader::writeShaderData(float value, essentials::BufferView buffer, graphics::ShaderDataType dataType) {
+	writeScalar(value, buffer, dataType);
+}
+
+void shader::writeShaderData(int value, essentials::BufferView buffer, graphics::ShaderDataType dataType) {
+	writeScalar(value, buffer, dataType);
+}
+
+void shader::writeShaderData(
+	const math::Vec2& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType)
+{
+	writeVector(vector, buffer, dataType);
+}
+
+void shader::writeShaderData(
+	const math::Vec3& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType)
+{
+	writeVector(vector, buffer, dataType);
+}
+
+void shader::writeShaderData(
+	const math::Vec4& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType)
+{
+	writeVector(vector, buffer, dataType);
+}
@@ -18,6 +18,7 @@
 #include "dormouse-engine/graphics/ShaderDataType.hpp"
 #include "dormouse-engine/math/Matrix.hpp"
 #include "dormouse-engine/math/Transform.hpp"
+#include "dormouse-engine/math/Vector.hpp"
 #include "../control/controlfwd.hpp"
 #include "../command/commandfwd.hpp"
 #include "PropertyId.hpp"
@@ -65,6 +66,31 @@ public:
 
 };
 
+// Built-in shader data types, written directly instead of through reflected functions. Scalars are
+// converted to the scalar type of the shader variable.
+
+void writeShaderData(float value, essentials::BufferView buffer, graphics::ShaderDataType dataType);
+
+void writeShaderData(int value, essentials::BufferView buffer, graphics::ShaderDataType dataType);
+
+void writeShaderData(const math::Vec2& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType);
+
+void writeShaderData(const math::Vec3& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType);
+
+void writeShaderData(const math::Vec4& vector, essentials::BufferView buffer, graphics::ShaderDataType dataType);
+
+inline void writeShaderData(
+	const math::Matrix4x4& matrix, essentials::BufferView buffer, graphics::ShaderDataType dataType)
+{
+	matrix.writeShaderData(buffer, dataType);
+}
+
+inline void writeShaderData(
+	const math::Transform& transform, essentials::BufferView buffer, graphics::ShaderDataType dataType)
+{
+	transform.writeShaderData(buffer, dataType);
+}
+
 class Property final {
 public:
 
@@ -0,0 +1,482 @@
+#include "ReflectionMetadata.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+const auto MAGIC = std::uint32_t(0x52535344); // "DSSR"
+
+const auto VERSION = std::uint32_t(1);
+
+template <class Enum>
+std::int32_t enumValue(Enum value) noexcept {
+	return static_cast<std::int32_t>(value);
+}
+
+template <class Enum>
+Enum toEnum(std::int32_t value) {
+	auto result = Enum();
+	try {
+		fromIntegral(result, static_cast<std::underlying_type_t<Enum>>(value));
+	} catch (const std::out_of_range& e) {
+		throw InvalidReflectionMetadata(e.what());
+	}
+	return result;
+}
+
+std::uint32_t count(size_t size) noexcept {
+	return static_cast<std::uint32_t>(size);
+}
+
+} // anonymous namespace
+
+// All records consist of 4 byte fields (the header also has an 8 byte one, but is followed by an even
+// number of 4 byte fields), so records of every section are aligned if the data is.
+struct ReflectionMetadata::Header {
+
+	std::uint32_t magic;
+
+	std::uint32_t version;
+
+	std::uint64_t bytecodeHash;
+
+	std::uint32_t inputParameterCount;
+
+	std::uint32_t constantBufferCount;
+
+	std::uint32_t variableCount;
+
+	std::uint32_t typeCount;
+
+	std::uint32_t resourceCount;
+
+	std::uint32_t stringsSize;
+
+};
+
+struct ReflectionMetadata::StringRecord {
+
+	std::uint32_t offset;
+
+	std::uint32_t length;
+
+};
+
+struct ReflectionMetadata::InputParameterRecord {
+
+	StringRecord semantic;
+
+	std::uint32_t semanticIndex;
+
+	std::int32_t dataType;
+
+	std::uint32_t elements;
+
+};
+
+struct ReflectionMetadata::ConstantBufferRecord {
+
+	StringRecord name;
+
+	std::uint32_t size;
+
+	std::uint32_t slot;
+
+	std::uint32_t firstVariable;
+
+	std::uint32_t variableCount;
+
+};
+
+struct ReflectionMetadata::VariableRecord {
+
+	StringRecord name;
+
+	std::uint32_t offset;
+
+	std::uint32_t size;
+
+	std::uint32_t type;
+
+};
+
+// Members of a type are stored contiguously, after the type itself
+struct ReflectionMetadata::TypeRecord {
+
+	StringRecord name;
+
+	StringRecord memberName;
+
+	std::uint32_t offset;
+
+	std::int32_t klass;
+
+	std::int32_t scalarType;
+
+	std::uint32_t columns;
+
+	std::uint32_t rows;
+
+	std::uint32_t elements;
+
+	std::uint32_t elementOffset;
+
+	std::uint32_t firstMember;
+
+	std::uint32_t memberCount;
+
+};
+
+struct ReflectionMetadata::ResourceRecord {
+
+	StringRecord name;
+
+	std::int32_t type;
+
+	std::uint32_t slot;
+
+	std::int32_t dimension;
+
+};
+
+class ReflectionMetadata::Writer {
+public:
+
+	essentials::ByteVector write(const graphics::ShaderReflection& reflection, std::uint64_t bytecodeHash) {
+		for (const auto& inputParameter : reflection.inputParameters()) {
+			auto record = InputParameterRecord();
+			record.semantic = string_(inputParameter.semantic);
+			record.semanticIndex = count(inputParameter.semanticIndex);
+			record.dataType = enumValue(inputParameter.dataType);
+			record.elements = count(inputParameter.elements);
+			inputParameters_.emplace_back(record);
+		}
+
+		for (const auto& constantBuffer : reflection.constantBuffers()) {
+			auto record = ConstantBufferRecord();
+			record.name = string_(constantBuffer.name);
+			record.size = count(constantBuffer.size);
+			record.slot = count(constantBuffer.slot);
+			record.firstVariable = count(variables_.size());
+			record.variableCount = count(constantBuffer.variables.size());
+			constantBuffers_.emplace_back(record);
+
+			for (const auto& variable : constantBuffer.variables) {
+				auto variableRecord = VariableRecord();
+				variableRecord.name = string_(variable.name);
+				variableRecord.offset = count(variable.offset);
+				variableRecord.size = count(variable.size);
+				variableRecord.type = count(types_.size());
+				variables_.emplace_back(variableRecord);
+
+				types_.emplace_back();
+				writeType_(variableRecord.type, std::string(), variable.type);
+			}
+		}
+
+		for (const auto& resource : reflection.resources()) {
+			auto record = ResourceRecord();
+			record.name = string_(resource.name);
+			record.type = enumValue(resource.type);
+			record.slot = count(resource.slot);
+			record.dimension = enumValue(resource.dimension);
+			resources_.emplace_back(record);
+		}
+
+		auto header = Header();
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.bytecodeHash = bytecodeHash;
+		header.inputParameterCount = count(inputParameters_.size());
+		header.constantBufferCount = count(constantBuffers_.size());
+		header.variableCount = count(variables_.size());
+		header.typeCount = count(types_.size());
+		header.resourceCount = count(resources_.size());
+		header.stringsSize = count(strings_.size());
+
+		auto data = essentials::ByteVector();
+		append_(data, &header, 1u);
+		append_(data, inputParameters_.data(), inputParameters_.size());
+		append_(data, constantBuffers_.data(), constantBuffers_.size());
+		append_(data, variables_.data(), variables_.size());
+		append_(data, types_.data(), types_.size());
+		append_(data, resources_.data(), resources_.size());
+		append_(data, strings_.data(), strings_.size());
+
+		return data;
+	}
+
+private:
+
+	std::vector<InputParameterRecord> inputParameters_;
+
+	std::vector<ConstantBufferRecord> constantBuffers_;
+
+	std::vector<VariableRecord> variables_;
+
+	std::vector<TypeRecord> types_;
+
+	std::vector<ResourceRecord> resources_;
+
+	std::string strings_;
+
+	template <class T>
+	static void append_(essentials::ByteVector& data, const T* elements, size_t elementCount) {
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		const auto* bytes = reinterpret_cast<const essentials::Byte*>(elements);
+		data.insert(data.end(), bytes, bytes + elementCount * sizeof(T));
+	}
+
+	StringRecord string_(const std::string& s) {
+		auto record = StringRecord();
+		record.offset = count(strings_.size());
+		record.length = count(s.size());
+		strings_ += s;
+		return record;
+	}
+
+	void writeType_(std::uint32_t index, const std::string& memberName, const graphics::ShaderReflection::Type& type) {
+		auto record = TypeRecord();
+		record.name = string_(type.name);
+		record.memberName = string_(memberName);
+		record.offset = count(type.offset);
+		record.klass = enumValue(type.dataType.klass);
+		record.scalarType = enumValue(type.dataType.scalarType);
+		record.columns = count(type.dataType.columns);
+		record.rows = count(type.dataType.rows);
+		record.elements = count(type.elements);
+		record.elementOffset = count(type.elementOffset);
+		record.firstMember = count(types_.size());
+		record.memberCount = count(type.members.size());
+		types_[index] = record;
+
+		types_.resize(types_.size() + type.members.size());
+
+		for (auto memberIdx = std::uint32_t(0); memberIdx < record.memberCount; ++memberIdx) {
+			const auto& member = type.members[memberIdx];
+			writeType_(
+				record.firstMember + memberIdx,
+				std::get<graphics::ShaderReflection::Type::MemberNameTag>(member),
+				std::get<graphics::ShaderReflection::Type::MemberTypeTag>(member)
+				);
+		}
+	}
+
+};
+
+essentials::ByteVector ReflectionMetadata::serialise(
+	const graphics::ShaderReflection& reflection, std::uint64_t bytecodeHash)
+{
+	return Writer().write(reflection, bytecodeHash);
+}
+
+ReflectionMetadata ReflectionMetadata::map(const boost::filesystem::path& path) {
+	try {
+		const auto file = boost::interprocess::file_mapping(path.string().c_str(), boost::interprocess::read_only);
+		auto region = std::make_shared<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+		const auto data = essentials::ConstBufferView(
+			static_cast<const essentials::Byte*>(region->get_address()), region->get_size());
+
+		return ReflectionMetadata(std::move(region), data);
+	} catch (const boost::interprocess::interprocess_exception& e) {
+		throw InvalidReflectionMetadata("failed to map " + path.string() + ": " + e.what());
+	}
+}
+
+ReflectionMetadata::ReflectionMetadata(essentials::ByteVector data) :
+	ReflectionMetadata(std::make_shared<const essentials::ByteVector>(std::move(data)))
+{
+}
+
+ReflectionMetadata::ReflectionMetadata(std::shared_ptr<const essentials::ByteVector> data) :
+	ReflectionMetadata(data, essentials::viewBuffer(*data))
+{
+}
+
+ReflectionMetadata::ReflectionMetadata(std::shared_ptr<const void> storage, essentials::ConstBufferView data) :
+	storage_(std::move(storage)),
+	data_(data)
+{
+	if (data_.size() < sizeof(Header)) {
+		throw InvalidReflectionMetadata("truncated header");
+	}
+
+	header_ = reinterpret_cast<const Header*>(data_.data());
+
+	if (header_->magic != MAGIC || header_->version != VERSION) {
+		throw InvalidReflectionMetadata("unknown format");
+	}
+
+	auto offset = sizeof(Header);
+	auto fixUp = [this, &offset](auto& section, std::uint32_t count) {
+			using Record = std::remove_reference_t<decltype(*section.records)>;
+
+			if ((data_.size() - offset) / sizeof(Record) < count) {
+				throw InvalidReflectionMetadata("truncated data");
+			}
+
+			section.records = reinterpret_cast<const Record*>(data_.data() + offset);
+			section.count = count;
+			offset += count * sizeof(Record);
+		};
+
+	fixUp(inputParameters_, header_->inputParameterCount);
+	fixUp(constantBuffers_, header_->constantBufferCount);
+	fixUp(variables_, header_->variableCount);
+	fixUp(types_, header_->typeCount);
+	fixUp(resources_, header_->resourceCount);
+
+	if (data_.size() - offset != header_->stringsSize) {
+		throw InvalidReflectionMetadata("size mismatch");
+	}
+
+	strings_ = reinterpret_cast<const char*>(data_.data() + offset);
+
+	validate_();
+}
+
+std::uint64_t ReflectionMetadata::bytecodeHash() const noexcept {
+	return header_->bytecodeHash;
+}
+
+graphics::ShaderReflection ReflectionMetadata::reflection() const {
+	auto inputParameters = graphics::ShaderReflection::InputParameterInfos();
+	inputParameters.reserve(inputParameters_.count);
+	for (auto idx = std::uint32_t(0); idx < inputParameters_.count; ++idx) {
+		const auto& record = inputParameters_[idx];
+
+		auto info = graphics::ShaderReflection::InputParameterInfo();
+		info.semantic = string_(record.semantic);
+		info.semanticIndex = record.semanticIndex;
+		info.dataType = toEnum<graphics::ShaderReflection::InputParameterInfo::DataType>(record.dataType);
+		info.elements = record.elements;
+		inputParameters.emplace_back(std::move(info));
+	}
+
+	auto constantBuffers = graphics::ShaderReflection::ConstantBufferInfos();
+	constantBuffers.reserve(constantBuffers_.count);
+	for (auto idx = std::uint32_t(0); idx < constantBuffers_.count; ++idx) {
+		const auto& record = constantBuffers_[idx];
+
+		auto info = graphics::ShaderReflection::ConstantBufferInfo();
+		info.name = string_(record.name);
+		info.size = record.size;
+		info.slot = record.slot;
+		info.variables.reserve(record.variableCount);
+
+		const auto variablesEnd = record.firstVariable + record.variableCount;
+		for (auto variableIdx = record.firstVariable; variableIdx < variablesEnd; ++variableIdx) {
+			const auto& variableRecord = variables_[variableIdx];
+
+			auto variable = graphics::ShaderReflection::Variable();
+			variable.name = string_(variableRecord.name);
+			variable.offset = variableRecord.offset;
+			variable.size = variableRecord.size;
+			variable.type = type_(variableRecord.type);
+			info.variables.emplace_back(std::move(variable));
+		}
+
+		constantBuffers.emplace_back(std::move(info));
+	}
+
+	auto resources = graphics::ShaderReflection::ResourceInfos();
+	resources.reserve(resources_.count);
+	for (auto idx = std::uint32_t(0); idx < resources_.count; ++idx) {
+		const auto& record = resources_[idx];
+
+		auto info = graphics::ShaderReflection::ResourceInfo();
+		info.type = toEnum<graphics::ShaderReflection::ResourceInfo::Type>(record.type);
+		info.name = string_(record.name);
+		info.slot = record.slot;
+		info.dimension = toEnum<graphics::ShaderReflection::ResourceInfo::Dimension>(record.dimension);
+		resources.emplace_back(std::move(info));
+	}
+
+	return graphics::ShaderReflection(std::move(inputParameters), std::move(constantBuffers), std::move(resources));
+}
+
+void ReflectionMetadata::validate_() const {
+	auto validString = [this](const StringRecord& record) {
+			return std::uint64_t(record.offset) + record.length <= header_->stringsSize;
+		};
+
+	for (auto idx = std::uint32_t(0); idx < inputParameters_.count; ++idx) {
+		if (!validString(inputParameters_[idx].semantic)) {
+			throw InvalidReflectionMetadata("input parameter semantic out of range");
+		}
+	}
+
+	for (auto idx = std::uint32_t(0); idx < constantBuffers_.count; ++idx) {
+		const auto& record = constantBuffers_[idx];
+		if (
+			!validString(record.name) ||
+			std::uint64_t(record.firstVariable) + record.variableCount > variables_.count
+			)
+		{
+			throw InvalidReflectionMetadata("constant buffer out of range");
+		}
+	}
+
+	for (auto idx = std::uint32_t(0); idx < variables_.count; ++idx) {
+		const auto& record = variables_[idx];
+		if (!validString(record.name) || record.type >= types_.count) {
+			throw InvalidReflectionMetadata("variable out of range");
+		}
+	}
+
+	// members following their type guarantee that reading the type tree terminates
+	for (auto idx = std::uint32_t(0); idx < types_.count; ++idx) {
+		const auto& record = types_[idx];
+		if (
+			!validString(record.name) ||
+			!validString(record.memberName) ||
+			(record.memberCount > 0u && record.firstMember <= idx) ||
+			std::uint64_t(record.firstMember) + record.memberCount > types_.count
+			)
+		{
+			throw InvalidReflectionMetadata("type out of range");
+		}
+	}
+
+	for (auto idx = std::uint32_t(0); idx < resources_.count; ++idx) {
+		if (!validString(resources_[idx].name)) {
+			throw InvalidReflectionMetadata("resource name out of range");
+		}
+	}
+}
+
+std::string ReflectionMetadata::string_(const StringRecord& record) const {
+	return std::string(strings_ + record.offset, record.length);
+}
+
+graphics::ShaderReflection::Type ReflectionMetadata::type_(std::uint32_t index) const {
+	const auto& record = types_[index];
+
+	auto type = graphics::ShaderReflection::Type();
+	type.name = string_(record.name);
+	type.offset = record.offset;
+	type.dataType.klass = toEnum<graphics::ShaderDataType::Class>(record.klass);
+	type.dataType.scalarType = toEnum<graphics::ShaderDataType::ScalarType>(record.scalarType);
+	type.dataType.columns = record.columns;
+	type.dataType.rows = record.rows;
+	type.elements = record.elements;
+	type.elementOffset = record.elementOffset;
+
+	type.members.reserve(record.memberCount);
+	const auto membersEnd = record.firstMember + record.memberCount;
+	for (auto memberIdx = record.firstMember; memberIdx < membersEnd; ++memberIdx) {
+		type.members.emplace_back(string_(types_[memberIdx].memberName), type_(memberIdx));
+	}
+
+	return type;
+}
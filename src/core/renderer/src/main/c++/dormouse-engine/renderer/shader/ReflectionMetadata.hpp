@@ -0,0 +1,112 @@
+#ifndef _DORMOUSEENGINE_RENDERER_SHADER_REFLECTIONMETADATA_HPP_
+#define _DORMOUSEENGINE_RENDERER_SHADER_REFLECTIONMETADATA_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <boost/filesystem/path.hpp>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/exceptions/RuntimeError.hpp"
+#include "dormouse-engine/graphics/ShaderReflection.hpp"
+
+namespace dormouse_engine::renderer::shader {
+
+class InvalidReflectionMetadata final : public exceptions::RuntimeError {
+public:
+
+	InvalidReflectionMetadata(const std::string& reason) :
+		exceptions::RuntimeError("Invalid shader reflection metadata: " + reason)
+	{
+	}
+
+};
+
+// Shader reflection data in a compact binary form, stored alongside compiled shader bytecode so that loading
+// a shader doesn't go through the reflection API. The data is a header followed by arrays of fixed size
+// records, which refer to each other and to a string table by index. It is validated once on construction
+// and then read in place, so it may live in a memory-mapped file.
+class ReflectionMetadata final {
+public:
+
+	static essentials::ByteVector serialise(const graphics::ShaderReflection& reflection, std::uint64_t bytecodeHash);
+
+	// Maps the file at path for reading. The mapping is released with the last copy of the returned object.
+	static ReflectionMetadata map(const boost::filesystem::path& path);
+
+	explicit ReflectionMetadata(essentials::ByteVector data);
+
+	// Hash of the bytecode the metadata was created from, as passed to serialise.
+	std::uint64_t bytecodeHash() const noexcept;
+
+	graphics::ShaderReflection reflection() const;
+
+	essentials::ConstBufferView data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	struct Header;
+
+	struct StringRecord;
+
+	struct InputParameterRecord;
+
+	struct ConstantBufferRecord;
+
+	struct VariableRecord;
+
+	struct TypeRecord;
+
+	struct ResourceRecord;
+
+	class Writer;
+
+	template <class Record>
+	struct Section {
+
+		const Record* records = nullptr;
+
+		std::uint32_t count = 0u;
+
+		const Record& operator[](std::uint32_t index) const noexcept {
+			return records[index];
+		}
+
+	};
+
+	std::shared_ptr<const void> storage_;
+
+	essentials::ConstBufferView data_;
+
+	const Header* header_ = nullptr;
+
+	Section<InputParameterRecord> inputParameters_;
+
+	Section<ConstantBufferRecord> constantBuffers_;
+
+	Section<VariableRecord> variables_;
+
+	Section<TypeRecord> types_;
+
+	Section<ResourceRecord> resources_;
+
+	const char* strings_ = nullptr;
+
+	explicit ReflectionMetadata(std::shared_ptr<const essentials::ByteVector> data);
+
+	ReflectionMetadata(std::shared_ptr<const void> storage, essentials::ConstBufferView data);
+
+	void validate_() const;
+
+	std::string string_(const StringRecord& record) const;
+
+	graphics::ShaderReflection::Type type_(std::uint32_t index) const;
+
+};
+
+} // namespace dormouse_engine::renderer::shader
+
+#endif /* _DORMOUSEENGINE_RENDERER_SHADER_REFLECTIONMETADATA_HPP_ */
@@ -90,19 +90,30 @@ detail::ShaderBase::ShaderBase(
 	graphics::Device& graphicsDevice,
 	graphics::ShaderType shaderType,
 	essentials::ConstBufferView compiledShaderObjectData
-	)
+	) :
+	ShaderBase(
+		graphicsDevice,
+		shaderType,
+		graphics::ShaderReflection(compiledShaderObjectData.data(), compiledShaderObjectData.size())
+		)
+{
+}
+
+detail::ShaderBase::ShaderBase(
+	graphics::Device& graphicsDevice,
+	graphics::ShaderType shaderType,
+	const graphics::ShaderReflection& reflectionData
+	) :
+	resources_(createResources_(reflectionData)),
+	constantBuffers_(createConstantBuffers_(graphicsDevice, shaderType, reflectionData))
 {
-	const auto reflectionData =
-		graphics::ShaderReflection(compiledShaderObjectData.data(), compiledShaderObjectData.size());
-	
-	resources_ = createResources_(reflectionData);
-	constantBuffers_ = createConstantBuffers_(graphicsDevice, shaderType, reflectionData);
 }
 
 void detail::ShaderBase::doRender(
 	command::DrawCommand& cmd,
 	const Property& root,
-	graphics::ShaderType shaderType
+	graphics::ShaderType shaderType,
+	ConstantBufferSlots externalConstantBuffers
 	) const
 {
 	for (const auto& resource : resources_) {
@@ -111,7 +122,9 @@ void detail::ShaderBase::doRender(
 	}
 
 	for (const auto& cb : constantBuffers_) {
-		cb.bind(cmd, root);
+		if (!externalConstantBuffers.test(cb.slot())) {
+			cb.bind(cmd, root);
+		}
 	}
 }
 
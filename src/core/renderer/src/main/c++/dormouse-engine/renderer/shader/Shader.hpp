@@ -1,9 +1,11 @@
 #ifndef _DORMOUSEENGINE_RENDERER_SHADER_SHADER_HPP_
 #define _DORMOUSEENGINE_RENDERER_SHADER_SHADER_HPP_
 
+#include <bitset>
 #include <vector>
 
 #include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/Buffer.hpp"
 #include "dormouse-engine/graphics/CommandList.hpp"
 #include "dormouse-engine/graphics/Shader.hpp"
 #include "dormouse-engine/graphics/ShaderReflection.hpp"
@@ -16,6 +18,9 @@ namespace dormouse_engine::renderer::shader {
 
 class Property;
 
+// Bit per constant buffer slot of a shader stage
+using ConstantBufferSlots = std::bitset<graphics::CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER>;
+
 namespace detail {
 
 class ShaderBase {
@@ -29,10 +34,17 @@ protected:
 		essentials::ConstBufferView compiledShaderObjectData
 		);
 
+	ShaderBase(
+		graphics::Device& graphicsDevice,
+		graphics::ShaderType shaderType,
+		const graphics::ShaderReflection& reflectionData
+		);
+
 	void doRender(
 		command::DrawCommand& cmd,
 		const Property& root,
-		graphics::ShaderType shaderType
+		graphics::ShaderType shaderType,
+		ConstantBufferSlots externalConstantBuffers
 		) const;
 
 private:
@@ -85,13 +97,30 @@ public:
 	{
 	}
 
+	// Uses reflectionData read earlier instead of reflecting compiledShaderObjectData.
+	Shader(
+		graphics::Device& graphicsDevice,
+		essentials::ConstBufferView compiledShaderObjectData,
+		const graphics::ShaderReflection& reflectionData
+		) :
+		ShaderBase(graphicsDevice, GraphicsShaderType::SHADER_TYPE, reflectionData),
+		shader_(graphicsDevice, std::move(compiledShaderObjectData))
+	{
+	}
+
 	// TODO: bind, render, bind* in ShaderBase - these are very misleading
 	void bind(graphics::CommandList& commandList) const {
 		commandList.setShader(shader_);
 	}
 
-	void render(command::DrawCommand& cmd, const Property& root) const {
-		doRender(cmd, root, GraphicsShaderType::SHADER_TYPE);
+	// Constant buffers in externalConstantBuffers are neither bound nor written, the caller provides them.
+	void render(
+		command::DrawCommand& cmd,
+		const Property& root,
+		ConstantBufferSlots externalConstantBuffers = ConstantBufferSlots()
+		) const
+	{
+		doRender(cmd, root, GraphicsShaderType::SHADER_TYPE, externalConstantBuffers);
 	}
 
 private:
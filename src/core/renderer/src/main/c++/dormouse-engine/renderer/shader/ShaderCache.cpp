@@ -0,0 +1,364 @@
+#include "ShaderCache.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "dormouse-engine/essentials/hash-bytes.hpp"
+#include "dormouse-engine/graphics/ShaderReflection.hpp"
+#include "dormouse-engine/logger.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+DE_LOGGER_CATEGORY("DORMOUSE_ENGINE.RENDERER.SHADER_CACHE");
+
+namespace /* anonymous */ {
+
+// Entry file layout: magic, version, include count, includes as (name length, name, content hash),
+// bytecode size, bytecode. Integers are stored in native byte order.
+const auto ENTRY_MAGIC = std::uint32_t(0x43535344); // "DSSC"
+
+const auto ENTRY_VERSION = std::uint32_t(1);
+
+const auto ENTRY_EXTENSION = ".dsc";
+
+const auto METADATA_EXTENSION = ".dsr";
+
+template <class T>
+std::uint64_t hashValue(const T& value, std::uint64_t seed) noexcept {
+	return essentials::hashBytes(reinterpret_cast<const essentials::Byte*>(&value), sizeof(value), seed);
+}
+
+std::uint64_t hashString(const std::string& s, std::uint64_t seed) noexcept {
+	seed = hashValue(s.size(), seed);
+	return essentials::hashBytes(s.data(), s.size(), seed);
+}
+
+std::uint64_t hashContent(const essentials::ByteVector* content) noexcept {
+	return content ? essentials::hashBytes(content->data(), content->size()) : essentials::FNV1A_OFFSET_BASIS;
+}
+
+template <class T>
+void write(std::ostream& os, const T& value) {
+	os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+bool read(std::istream& is, T& value) {
+	return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+// Written to a temporary file and renamed, so that concurrent readers never see a partial file
+template <class WriteFunc>
+void storeFile(const boost::filesystem::path& path, WriteFunc writeFunc) {
+	try {
+		const auto tmpPath = boost::filesystem::unique_path(path.string() + ".%%%%-%%%%.tmp");
+
+		{
+			auto os = std::ofstream(tmpPath.string(), std::ios::binary);
+
+			writeFunc(os);
+
+			if (!os) {
+				DE_LOG_WARNING << "Failed to write shader cache file " << tmpPath.string();
+				os.close();
+				boost::filesystem::remove(tmpPath);
+				return;
+			}
+		}
+
+		boost::filesystem::rename(tmpPath, path);
+	} catch (const boost::filesystem::filesystem_error& e) {
+		DE_LOG_WARNING << "Failed to store shader cache file " << path.string() << ": " << e.what();
+	}
+}
+
+} // anonymous namespace
+
+ShaderCache::ShaderCache(CompilerFlags globalFlags) :
+	compiler_(globalFlags),
+	globalFlags_(globalFlags.integralValue())
+{
+}
+
+ShaderCache::ShaderCache(boost::filesystem::path directory, CompilerFlags globalFlags) :
+	compiler_(globalFlags),
+	globalFlags_(globalFlags.integralValue()),
+	directory_(std::move(directory))
+{
+	boost::filesystem::create_directories(directory_);
+}
+
+ShaderCache::Bytecode ShaderCache::compile(const Compilation& compilation) {
+	return compileReflected(compilation).bytecode;
+}
+
+ShaderCache::CompiledShader ShaderCache::compileReflected(const Compilation& compilation) {
+	const auto key = key_(compilation);
+	const auto& includeHandler = compilation.includeHandler;
+
+	if (auto compiled = findInMemory_(key, includeHandler); compiled.bytecode) {
+		return compiled;
+	}
+
+	auto entry = Entry();
+	auto loaded = !directory_.empty() && load_(key, entry);
+	auto reflected = false;
+
+	if (loaded) {
+		loaded = std::all_of(entry.includes.begin(), entry.includes.end(), [&includeHandler](const auto& include) {
+				const auto content = includeHandler ? includeHandler(include.first) : nullptr;
+				return hashContent(content.get()) == include.second;
+			});
+	}
+
+	if (loaded) {
+		entry.metadata = loadMetadata_(key, *entry.bytecode);
+
+		if (!entry.metadata) {
+			entry.metadata = reflect_(*entry.bytecode);
+			reflected = true;
+			storeMetadata_(key, *entry.metadata);
+		}
+	} else {
+		entry.includes.clear();
+
+		// the compiler doesn't resolve includes without a handler, so only a given handler is wrapped
+		auto recordingHandler = IncludeHandler();
+		if (includeHandler) {
+			recordingHandler = [&entry, &includeHandler](const std::string& name) {
+					auto content = includeHandler(name);
+					entry.includes.emplace_back(name, hashContent(content.get()));
+					return content;
+				};
+		}
+
+		entry.bytecode = std::make_shared<const essentials::ByteVector>(compiler_.compile(
+			compilation.code,
+			compilation.name,
+			compilation.entrypoint,
+			compilation.type,
+			std::move(recordingHandler),
+			compilation.flags
+			));
+
+		entry.metadata = reflect_(*entry.bytecode);
+		reflected = true;
+
+		if (!directory_.empty()) {
+			store_(key, entry);
+		}
+	}
+
+	auto lock = std::unique_lock<std::mutex>(mutex_);
+
+	if (loaded) {
+		++statistics_.diskHits;
+	} else {
+		++statistics_.compilations;
+	}
+
+	if (reflected) {
+		++statistics_.reflections;
+	}
+
+	auto compiled = CompiledShader{ entry.bytecode, entry.metadata };
+	entries_.insert_or_assign(key, std::make_shared<const Entry>(std::move(entry)));
+	return compiled;
+}
+
+ShaderCache::Bytecode ShaderCache::compile(
+	essentials::ConstBufferView code,
+	const std::string& name,
+	const std::string& entrypoint,
+	graphics::ShaderType type,
+	IncludeHandler includeHandler,
+	CompilerFlags flags
+	)
+{
+	return compile(Compilation{ code, name, entrypoint, type, std::move(includeHandler), flags });
+}
+
+void ShaderCache::warmUp(const std::vector<Compilation>& compilations, essentials::ThreadPool& threadPool) {
+	auto compiled = std::vector<std::future<CompiledShader>>();
+	compiled.reserve(compilations.size());
+
+	for (const auto& compilation : compilations) {
+		compiled.emplace_back(threadPool.submit([this, &compilation]() { return compileReflected(compilation); }));
+	}
+
+	// all tasks reference compilations, so none may be left running when an error is rethrown
+	auto error = std::exception_ptr();
+	for (auto& shader : compiled) {
+		try {
+			shader.get();
+		} catch (...) {
+			if (!error) {
+				error = std::current_exception();
+			}
+		}
+	}
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+ShaderCache::Statistics ShaderCache::statistics() const {
+	auto lock = std::unique_lock<std::mutex>(mutex_);
+	return statistics_;
+}
+
+std::uint64_t ShaderCache::key_(const Compilation& compilation) const noexcept {
+	auto key = essentials::hashBytes(compilation.code.data(), compilation.code.size());
+	key = hashString(compilation.name, key);
+	key = hashString(compilation.entrypoint, key);
+	key = hashValue(compilation.type, key);
+	key = hashValue(compilation.flags.integralValue(), key);
+	key = hashValue(globalFlags_, key);
+	return key;
+}
+
+boost::filesystem::path ShaderCache::entryPath_(std::uint64_t key, const char* extension) const {
+	auto fileName = std::ostringstream();
+	fileName << std::hex << std::setw(16) << std::setfill('0') << key << extension;
+	return directory_ / fileName.str();
+}
+
+ShaderCache::CompiledShader ShaderCache::findInMemory_(std::uint64_t key, const IncludeHandler& includeHandler) {
+	auto lock = std::unique_lock<std::mutex>(mutex_);
+
+	const auto it = entries_.find(key);
+	if (it == entries_.end()) {
+		return CompiledShader();
+	}
+
+	// the include handler isn't called under the lock
+	const auto entry = it->second;
+	lock.unlock();
+
+	for (const auto& include : entry->includes) {
+		const auto content = includeHandler ? includeHandler(include.first) : nullptr;
+		if (hashContent(content.get()) != include.second) {
+			return CompiledShader();
+		}
+	}
+
+	lock.lock();
+	++statistics_.memoryHits;
+	return CompiledShader{ entry->bytecode, entry->metadata };
+}
+
+bool ShaderCache::load_(std::uint64_t key, Entry& entry) const {
+	const auto path = entryPath_(key, ENTRY_EXTENSION);
+
+	auto is = std::ifstream(path.string(), std::ios::binary);
+	if (!is) {
+		return false;
+	}
+
+	auto magic = std::uint32_t();
+	auto version = std::uint32_t();
+	if (!read(is, magic) || magic != ENTRY_MAGIC || !read(is, version) || version != ENTRY_VERSION) {
+		DE_LOG_WARNING << "Ignoring shader cache entry " << path.string() << " of unknown format";
+		return false;
+	}
+
+	auto includeCount = std::uint32_t();
+	if (!read(is, includeCount)) {
+		return false;
+	}
+
+	auto includes = Includes();
+	includes.reserve(includeCount);
+	for (auto includeIdx = std::uint32_t(0); includeIdx < includeCount; ++includeIdx) {
+		auto nameLength = std::uint32_t();
+		if (!read(is, nameLength)) {
+			return false;
+		}
+
+		auto name = std::string(nameLength, '\0');
+		auto contentHash = std::uint64_t();
+		if (!is.read(name.data(), nameLength) || !read(is, contentHash)) {
+			return false;
+		}
+
+		includes.emplace_back(std::move(name), contentHash);
+	}
+
+	auto bytecodeSize = std::uint64_t();
+	if (!read(is, bytecodeSize)) {
+		return false;
+	}
+
+	auto bytecode = essentials::ByteVector(static_cast<size_t>(bytecodeSize));
+	if (!is.read(reinterpret_cast<char*>(bytecode.data()), bytecode.size())) {
+		DE_LOG_WARNING << "Ignoring truncated shader cache entry " << path.string();
+		return false;
+	}
+
+	entry.includes = std::move(includes);
+	entry.bytecode = std::make_shared<const essentials::ByteVector>(std::move(bytecode));
+	return true;
+}
+
+ShaderCache::Metadata ShaderCache::loadMetadata_(std::uint64_t key, const essentials::ByteVector& bytecode) const {
+	const auto path = entryPath_(key, METADATA_EXTENSION);
+
+	auto error = boost::system::error_code();
+	if (!boost::filesystem::exists(path, error)) {
+		return nullptr;
+	}
+
+	try {
+		auto metadata = std::make_shared<const ReflectionMetadata>(ReflectionMetadata::map(path));
+
+		// entries may be replaced without their metadata, e.g. if the latter is mapped by another process
+		if (metadata->bytecodeHash() == essentials::hashBytes(bytecode.data(), bytecode.size())) {
+			return metadata;
+		}
+
+		DE_LOG_WARNING << "Ignoring shader reflection metadata " << path.string() << " of different bytecode";
+	} catch (const InvalidReflectionMetadata& e) {
+		DE_LOG_WARNING << "Ignoring shader reflection metadata " << path.string() << ": " << e.what();
+	}
+
+	return nullptr;
+}
+
+void ShaderCache::store_(std::uint64_t key, const Entry& entry) const {
+	storeFile(entryPath_(key, ENTRY_EXTENSION), [&entry](std::ostream& os) {
+			write(os, ENTRY_MAGIC);
+			write(os, ENTRY_VERSION);
+			write(os, static_cast<std::uint32_t>(entry.includes.size()));
+			for (const auto& include : entry.includes) {
+				write(os, static_cast<std::uint32_t>(include.first.size()));
+				os.write(include.first.data(), include.first.size());
+				write(os, include.second);
+			}
+			write(os, static_cast<std::uint64_t>(entry.bytecode->size()));
+			os.write(reinterpret_cast<const char*>(entry.bytecode->data()), entry.bytecode->size());
+		});
+
+	storeMetadata_(key, *entry.metadata);
+}
+
+void ShaderCache::storeMetadata_(std::uint64_t key, const ReflectionMetadata& metadata) const {
+	storeFile(entryPath_(key, METADATA_EXTENSION), [&metadata](std::ostream& os) {
+			const auto data = metadata.data();
+			os.write(reinterpret_cast<const char*>(data.data()), data.size());
+		});
+}
+
+ShaderCache::Metadata ShaderCache::reflect_(const essentials::ByteVector& bytecode) {
+	const auto reflection = graphics::ShaderReflection(bytecode.data(), bytecode.size());
+	return std::make_shared<const ReflectionMetadata>(
+		ReflectionMetadata::serialise(reflection, essentials::hashBytes(bytecode.data(), bytecode.size())));
+}
@@ -0,0 +1,160 @@
+#ifndef _DORMOUSEENGINE_RENDERER_SHADER_SHADERCACHE_HPP_
+#define _DORMOUSEENGINE_RENDERER_SHADER_SHADERCACHE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "dormouse-engine/essentials/ThreadPool.hpp"
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/ShaderCompiler.hpp"
+#include "dormouse-engine/graphics/ShaderType.hpp"
+#include "ReflectionMetadata.hpp"
+
+namespace dormouse_engine::renderer::shader {
+
+// Front of graphics::ShaderCompiler which doesn't compile the same shader twice. Compiled bytecode is keyed
+// by a hash of the code, name, entrypoint, shader type and compiler flags and kept in memory. If a
+// directory is given, it's also stored there, one file per key, so that later runs skip compilation.
+// Each entry lists the files included during its compilation with hashes of their content, and is used only
+// if the include handler still returns the same content for all of them.
+// Shaders are reflected once, on compilation, and the reflection data is kept with the bytecode as
+// ReflectionMetadata. On disk it's stored in a sidecar file, which is memory-mapped when loaded.
+// Safe to use from multiple threads.
+class ShaderCache final {
+public:
+
+	using IncludeHandler = graphics::ShaderCompiler::IncludeHandler;
+
+	using CompilerFlags = graphics::ShaderCompiler::CompilerFlags;
+
+	using Bytecode = std::shared_ptr<const essentials::ByteVector>;
+
+	using Metadata = std::shared_ptr<const ReflectionMetadata>;
+
+	struct CompiledShader {
+
+		Bytecode bytecode;
+
+		Metadata metadata;
+
+	};
+
+	// Arguments of a single graphics::ShaderCompiler::compile call. The code must outlive the compilation.
+	struct Compilation {
+
+		essentials::ConstBufferView code;
+
+		std::string name;
+
+		std::string entrypoint;
+
+		graphics::ShaderType type;
+
+		IncludeHandler includeHandler;
+
+		CompilerFlags flags;
+
+	};
+
+	struct Statistics {
+
+		size_t memoryHits = 0u;
+
+		size_t diskHits = 0u;
+
+		size_t compilations = 0u;
+
+		size_t reflections = 0u;
+
+	};
+
+	// Keeps compiled shaders in memory only.
+	explicit ShaderCache(CompilerFlags globalFlags = CompilerFlags());
+
+	// Keeps compiled shaders in memory and in directory, which is created if it doesn't exist.
+	ShaderCache(boost::filesystem::path directory, CompilerFlags globalFlags = CompilerFlags());
+
+	Bytecode compile(const Compilation& compilation);
+
+	CompiledShader compileReflected(const Compilation& compilation);
+
+	Bytecode compile(
+		essentials::ConstBufferView code,
+		const std::string& name,
+		const std::string& entrypoint,
+		graphics::ShaderType type,
+		IncludeHandler includeHandler = IncludeHandler(),
+		CompilerFlags flags = CompilerFlags()
+		);
+
+	// Compiles the given shaders on threadPool, so that subsequent compile calls for them are memory hits.
+	// Blocks until all are done and rethrows the first compilation error. Mustn't be called from a task
+	// of threadPool.
+	void warmUp(const std::vector<Compilation>& compilations, essentials::ThreadPool& threadPool);
+
+	Statistics statistics() const;
+
+	const boost::filesystem::path& directory() const noexcept {
+		return directory_;
+	}
+
+private:
+
+	// Name of an included file and the hash of its content
+	using Include = std::pair<std::string, std::uint64_t>;
+
+	using Includes = std::vector<Include>;
+
+	struct Entry {
+
+		Includes includes;
+
+		Bytecode bytecode;
+
+		Metadata metadata;
+
+	};
+
+	// Shared, so that the lock is released before an entry's includes are checked without copying them
+	using Entries = std::unordered_map<std::uint64_t, std::shared_ptr<const Entry>>;
+
+	graphics::ShaderCompiler compiler_;
+
+	std::uint64_t globalFlags_;
+
+	boost::filesystem::path directory_;
+
+	mutable std::mutex mutex_;
+
+	Entries entries_;
+
+	Statistics statistics_;
+
+	std::uint64_t key_(const Compilation& compilation) const noexcept;
+
+	boost::filesystem::path entryPath_(std::uint64_t key, const char* extension) const;
+
+	CompiledShader findInMemory_(std::uint64_t key, const IncludeHandler& includeHandler);
+
+	bool load_(std::uint64_t key, Entry& entry) const;
+
+	Metadata loadMetadata_(std::uint64_t key, const essentials::ByteVector& bytecode) const;
+
+	void store_(std::uint64_t key, const Entry& entry) const;
+
+	void storeMetadata_(std::uint64_t key, const ReflectionMetadata& metadata) const;
+
+	static Metadata reflect_(const essentials::ByteVector& bytecode);
+
+};
+
+} // namespace dormouse_engine::renderer::shader
+
+#endif /* _DORMOUSEENGINE_RENDERER_SHADER_SHADERCACHE_HPP_ */
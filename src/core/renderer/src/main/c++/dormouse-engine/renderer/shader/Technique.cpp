@@ -4,20 +4,54 @@ using namespace dormouse_engine;
 using namespace dormouse_engine::renderer;
 using namespace dormouse_engine::renderer::shader;
 
-void Technique::bind(graphics::CommandList& commandList) const {
+namespace /* anonymous */ {
+
+// The shaders of inactive stages are empty, so binding them clears the stage
+template <class ShaderType>
+void bindStage(
+	graphics::CommandList& commandList,
+	const ShaderType& shader,
+	graphics::ShaderType stage,
+	Technique::StageMask stagesToBind
+	)
+{
+	if ((stagesToBind & Technique::stageBit(stage)) != 0u) {
+		shader.bind(commandList);
+	}
+}
+
+} // anonymous namespace
+
+void Technique::bind(graphics::CommandList& commandList, StageMask boundStages) const {
+	const auto stagesToBind = static_cast<StageMask>(activeStages_ | boundStages);
+
 	inputLayout_.bind(commandList);
-	vertexShader_.bind(commandList);
-	geometryShader_.bind(commandList);
-	domainShader_.bind(commandList);
-	hullShader_.bind(commandList);
-	pixelShader_.bind(commandList);
+	bindStage(commandList, vertexShader_, graphics::ShaderType::VERTEX, stagesToBind);
+	bindStage(commandList, geometryShader_, graphics::ShaderType::GEOMETRY, stagesToBind);
+	bindStage(commandList, domainShader_, graphics::ShaderType::DOMAIN, stagesToBind);
+	bindStage(commandList, hullShader_, graphics::ShaderType::HULL, stagesToBind);
+	bindStage(commandList, pixelShader_, graphics::ShaderType::PIXEL, stagesToBind);
 }
 
 void Technique::render(command::DrawCommand& cmd, const Property& root) const
 {
-	vertexShader_.render(cmd, root);
-	geometryShader_.render(cmd, root);
-	domainShader_.render(cmd, root);
-	hullShader_.render(cmd, root);
-	pixelShader_.render(cmd, root);
+	const auto externalConstantBuffers = [this](graphics::ShaderType stage) {
+		return externalConstantBuffers_[static_cast<size_t>(stage)];
+	};
+
+	if (active(graphics::ShaderType::VERTEX)) {
+		vertexShader_.render(cmd, root, externalConstantBuffers(graphics::ShaderType::VERTEX));
+	}
+	if (active(graphics::ShaderType::GEOMETRY)) {
+		geometryShader_.render(cmd, root, externalConstantBuffers(graphics::ShaderType::GEOMETRY));
+	}
+	if (active(graphics::ShaderType::DOMAIN)) {
+		domainShader_.render(cmd, root, externalConstantBuffers(graphics::ShaderType::DOMAIN));
+	}
+	if (active(graphics::ShaderType::HULL)) {
+		hullShader_.render(cmd, root, externalConstantBuffers(graphics::ShaderType::HULL));
+	}
+	if (active(graphics::ShaderType::PIXEL)) {
+		pixelShader_.render(cmd, root, externalConstantBuffers(graphics::ShaderType::PIXEL));
+	}
 }
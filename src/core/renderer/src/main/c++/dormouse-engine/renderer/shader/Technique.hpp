@@ -2,8 +2,10 @@
 #define _DORMOUSEENGINE_RENDERER_SHADER_TECHNIQUE_HPP_
 
 #include <array>
+#include <cstdint>
 
 #include "dormouse-engine/graphics/CommandList.hpp"
+#include "dormouse-engine/graphics/ShaderType.hpp"
 #include "../command/commandfwd.hpp"
 #include "InputLayout.hpp"
 #include "Shader.hpp"
@@ -12,12 +14,25 @@ namespace dormouse_engine::renderer::shader {
 
 class Property;
 
+// Input layout and shaders of a draw. Only the stages which had a shader set are active - the others are
+// skipped when binding and rendering.
 class Technique {
 public:
 
+	// Bit per graphics::ShaderType
+	using StageMask = std::uint8_t;
+
+	static constexpr auto ALL_STAGES = StageMask(0x1f);
+
+	static constexpr StageMask stageBit(graphics::ShaderType stage) noexcept {
+		return static_cast<StageMask>(1u << static_cast<unsigned int>(stage));
+	}
+
 	Technique() = default;
 
-	void bind(graphics::CommandList& commandList) const;
+	// Binds the input layout and the active stages. Inactive stages in boundStages are cleared, the other
+	// inactive stages are not touched.
+	void bind(graphics::CommandList& commandList, StageMask boundStages = ALL_STAGES) const;
 
 	void render(command::DrawCommand& cmd, const Property& root) const;
 
@@ -27,26 +42,54 @@ public:
 
 	void setShader(VertexShader shader) {
 		vertexShader_ = std::move(shader);
+		activeStages_ |= stageBit(graphics::ShaderType::VERTEX);
 	}
 
 	void setShader(GeometryShader shader) {
 		geometryShader_ = std::move(shader);
+		activeStages_ |= stageBit(graphics::ShaderType::GEOMETRY);
 	}
 
 	void setShader(DomainShader shader) {
 		domainShader_ = std::move(shader);
+		activeStages_ |= stageBit(graphics::ShaderType::DOMAIN);
 	}
 
 	void setShader(HullShader shader) {
 		hullShader_ = std::move(shader);
+		activeStages_ |= stageBit(graphics::ShaderType::HULL);
 	}
 
 	void setShader(PixelShader shader) {
 		pixelShader_ = std::move(shader);
+		activeStages_ |= stageBit(graphics::ShaderType::PIXEL);
+	}
+
+	StageMask activeStages() const noexcept {
+		return activeStages_;
+	}
+
+	bool active(graphics::ShaderType stage) const noexcept {
+		return (activeStages_ & stageBit(stage)) != 0u;
+	}
+
+	// Marks the constant buffer at stage and slot as provided by the commands drawn with this technique,
+	// through DrawCommand::setSharedConstantBuffer. render() then doesn't write it per command, so its
+	// parameters needn't be bound as properties.
+	void setExternalConstantBuffer(graphics::ShaderType stage, size_t slot) {
+		externalConstantBuffers_[static_cast<size_t>(stage)].set(slot);
+	}
+
+	bool externalConstantBuffer(graphics::ShaderType stage, size_t slot) const {
+		return externalConstantBuffers_[static_cast<size_t>(stage)].test(slot);
 	}
 
 private:
 
+	StageMask activeStages_ = 0u;
+
+	std::array<ConstantBufferSlots, 5> externalConstantBuffers_; // vs, gs, hs, ds, ps
+
 	InputLayout inputLayout_;
 
 	VertexShader vertexShader_;
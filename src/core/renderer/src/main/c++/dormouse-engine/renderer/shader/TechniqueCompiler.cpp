@@ -0,0 +1,129 @@
+#include "TechniqueCompiler.hpp"
+
+#include <utility>
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+template <class ShaderType>
+auto createShader(graphics::Device& graphicsDevice) {
+	return [&graphicsDevice](essentials::ConstBufferView bytecode, const graphics::ShaderReflection& reflection) {
+			return ShaderType(graphicsDevice, bytecode, reflection);
+		};
+}
+
+template <class ShaderType>
+void setStage(Technique& technique, std::future<ShaderType>& stage) {
+	if (stage.valid()) {
+		technique.setShader(stage.get());
+	}
+}
+
+} // anonymous namespace
+
+TechniqueCompiler::TechniqueCompiler(
+	graphics::Device& graphicsDevice, ShaderCache& shaderCache, essentials::ThreadPool& threadPool) :
+	graphicsDevice_(graphicsDevice),
+	shaderCache_(shaderCache),
+	threadPool_(essentials::make_observer(&threadPool))
+{
+}
+
+TechniqueCompiler::TechniqueCompiler(graphics::Device& graphicsDevice, ShaderCache& shaderCache) :
+	graphicsDevice_(graphicsDevice),
+	shaderCache_(shaderCache)
+{
+}
+
+std::future<Technique> TechniqueCompiler::compile(Description description) {
+	// the input layout is created in the vertex shader task, as it may need the same reflection data
+	auto vertexStage = compileStage_(
+		description,
+		description.vertexShaderEntrypoint,
+		graphics::ShaderType::VERTEX,
+		[&graphicsDevice = graphicsDevice_, elements = std::move(description.inputLayoutElements)](
+			essentials::ConstBufferView bytecode,
+			const graphics::ShaderReflection& reflection
+			)
+		{
+			auto inputLayout = elements ? InputLayout(graphicsDevice, *elements) : InputLayout(graphicsDevice, reflection);
+			return std::make_pair(VertexShader(graphicsDevice, bytecode, reflection), std::move(inputLayout));
+		});
+	auto geometryShader = compileStage_(
+		description,
+		description.geometryShaderEntrypoint,
+		graphics::ShaderType::GEOMETRY,
+		createShader<GeometryShader>(graphicsDevice_)
+		);
+	auto hullShader = compileStage_(
+		description,
+		description.hullShaderEntrypoint,
+		graphics::ShaderType::HULL,
+		createShader<HullShader>(graphicsDevice_)
+		);
+	auto domainShader = compileStage_(
+		description,
+		description.domainShaderEntrypoint,
+		graphics::ShaderType::DOMAIN,
+		createShader<DomainShader>(graphicsDevice_)
+		);
+	auto pixelShader = compileStage_(
+		description,
+		description.pixelShaderEntrypoint,
+		graphics::ShaderType::PIXEL,
+		createShader<PixelShader>(graphicsDevice_)
+		);
+
+	// deferred, so that no pool thread is blocked waiting for the stages
+	return std::async(
+		std::launch::deferred,
+		[
+			vertexStage = std::move(vertexStage),
+			geometryShader = std::move(geometryShader),
+			hullShader = std::move(hullShader),
+			domainShader = std::move(domainShader),
+			pixelShader = std::move(pixelShader)
+		]() mutable {
+			auto technique = Technique();
+
+			if (vertexStage.valid()) {
+				auto [vertexShader, inputLayout] = vertexStage.get();
+				technique.setShader(std::move(vertexShader));
+				technique.setInputLayout(std::move(inputLayout));
+			}
+
+			setStage(technique, geometryShader);
+			setStage(technique, hullShader);
+			setStage(technique, domainShader);
+			setStage(technique, pixelShader);
+
+			return technique;
+		});
+}
+
+template <class Create>
+auto TechniqueCompiler::compileStage_(
+	const Description& description, const std::string& entrypoint, graphics::ShaderType type, Create create)
+	-> std::future<std::invoke_result_t<Create, essentials::ConstBufferView, const graphics::ShaderReflection&>>
+{
+	if (entrypoint.empty()) {
+		return {};
+	}
+
+	auto compilation = ShaderCache::Compilation{
+		description.code, description.name, entrypoint, type, description.includeHandler, description.flags };
+
+	auto task = [&shaderCache = shaderCache_, compilation = std::move(compilation), create = std::move(create)]() {
+			const auto compiled = shaderCache.compileReflected(compilation);
+			return create(essentials::viewBuffer(*compiled.bytecode), compiled.metadata->reflection());
+		};
+
+	if (threadPool_) {
+		return threadPool_->submit(std::move(task));
+	} else {
+		return std::async(std::launch::deferred, std::move(task));
+	}
+}
@@ -0,0 +1,83 @@
+#ifndef _DORMOUSEENGINE_RENDERER_SHADER_TECHNIQUECOMPILER_HPP_
+#define _DORMOUSEENGINE_RENDERER_SHADER_TECHNIQUECOMPILER_HPP_
+
+#include <future>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/essentials/observer_ptr.hpp"
+#include "dormouse-engine/essentials/ThreadPool.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "dormouse-engine/graphics/InputLayout.hpp"
+#include "ShaderCache.hpp"
+#include "Technique.hpp"
+
+namespace dormouse_engine::renderer::shader {
+
+// Builds Techniques on a thread pool. Each stage is compiled through the shader cache and has its resources
+// and constant buffers created from the cached reflection metadata in a separate task, so techniques
+// requested together at startup are built in parallel with each other and with the caller. Without a thread
+// pool the stages are compiled on the thread calling get on the returned future.
+class TechniqueCompiler final {
+public:
+
+	struct Description {
+
+		// Must outlive the returned future
+		essentials::ConstBufferView code;
+
+		std::string name;
+
+		ShaderCache::IncludeHandler includeHandler;
+
+		ShaderCache::CompilerFlags flags;
+
+		// Stages with empty entrypoints are not compiled
+		std::string vertexShaderEntrypoint;
+
+		std::string geometryShaderEntrypoint;
+
+		std::string hullShaderEntrypoint;
+
+		std::string domainShaderEntrypoint;
+
+		std::string pixelShaderEntrypoint;
+
+		// If not set, the input layout is created from the vertex shader's input signature
+		std::optional<graphics::InputLayout::Elements> inputLayoutElements;
+
+	};
+
+	TechniqueCompiler(graphics::Device& graphicsDevice, ShaderCache& shaderCache, essentials::ThreadPool& threadPool);
+
+	// Compiles synchronously, on the thread assembling the technique.
+	TechniqueCompiler(graphics::Device& graphicsDevice, ShaderCache& shaderCache);
+
+	// Submits the compilation of all stages in description and returns the technique assembled from them.
+	// The returned future is deferred - the technique is assembled on the thread calling get, which rethrows
+	// the first compilation error. The compiler, cache and thread pool must outlive it.
+	std::future<Technique> compile(Description description);
+
+private:
+
+	graphics::Device& graphicsDevice_;
+
+	ShaderCache& shaderCache_;
+
+	// Null if compiling synchronously
+	essentials::observer_ptr<essentials::ThreadPool> threadPool_;
+
+	// Submits a task compiling the given stage and passing its bytecode and reflection data to create, or
+	// defers it if there is no thread pool. Returns an invalid future if entrypoint is empty.
+	template <class Create>
+	auto compileStage_(
+		const Description& description, const std::string& entrypoint, graphics::ShaderType type, Create create)
+		-> std::future<std::invoke_result_t<Create, essentials::ConstBufferView, const graphics::ShaderReflection&>>;
+
+};
+
+} // namespace dormouse_engine::renderer::shader
+
+#endif /* _DORMOUSEENGINE_RENDERER_SHADER_TECHNIQUECOMPILER_HPP_ */
@@ -1,6 +1,16 @@
 struct VIn {
 	float2 posL : POSITION;
 	float2 tex : TEXCOORD;
+	float4 toNDC0 : INSTANCE_TO_NDC0; // layout.toNDC rows, per-instance
+	float4 toNDC1 : INSTANCE_TO_NDC1;
+	float4 toNDC2 : INSTANCE_TO_NDC2;
+	float4 toNDC3 : INSTANCE_TO_NDC3;
+	float4 textureRegion : INSTANCE_TEXTURE_REGION; // origin in xy, size in zw
+};
+
+struct VInBatch { // SpriteBatch vertices, already transformed
+	float2 posNDC : POSITION;
+	float2 tex : TEXCOORD;
 };
 
 struct PIn {
@@ -8,8 +18,8 @@ struct PIn {
 	float2 tex : TEXCOORD;
 };
 
-cbuffer sprite {
-	matrix layout_toNDC;
+cbuffer view : register(b0) { // shared by all sprites, set with Sprite::setViewTransform
+	row_major float4x4 view_transform;
 };
 
 Texture2D sprite_texture : register(t0);
@@ -18,8 +28,18 @@ SamplerState sprite_sampler : register(s0);
 PIn vs(VIn vin) {
 	PIn pin;
 	
+	float4x4 toNDC = float4x4(vin.toNDC0, vin.toNDC1, vin.toNDC2, vin.toNDC3);
 	float4 pos = float4(vin.posL, 0.0f, 1.0f);
-	pin.posH = mul(pos, layout_toNDC);
+	pin.posH = mul(mul(pos, toNDC), view_transform);
+	pin.tex = vin.textureRegion.xy + vin.tex * vin.textureRegion.zw;
+	
+	return pin;
+}
+
+PIn vsBatch(VInBatch vin) {
+	PIn pin;
+	
+	pin.posH = mul(float4(vin.posNDC, 0.0f, 1.0f), view_transform);
 	pin.tex = vin.tex;
 	
 	return pin;
@@ -0,0 +1,69 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <vector>
+
+#include "dormouse-engine/renderer/command/CommandArena.hpp"
+
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+struct ResettableCommand {
+
+	size_t value = 0u;
+
+	size_t resetCount = 0u;
+
+	void reset() {
+		value = 0u;
+		++resetCount;
+	}
+
+};
+
+using Arena = CommandArena<ResettableCommand, 4u>;
+
+BOOST_AUTO_TEST_SUITE(CommandArenaTestSuite);
+
+BOOST_AUTO_TEST_CASE(ReferencesRemainValidWhenArenaGrows) {
+	auto arena = Arena();
+	auto commands = std::vector<ResettableCommand*>();
+
+	for (auto idx = size_t(0); idx < 10u; ++idx) {
+		auto& command = arena.allocate();
+		command.value = idx;
+		commands.emplace_back(&command);
+	}
+
+	BOOST_CHECK_EQUAL(arena.size(), 10u);
+	BOOST_CHECK_EQUAL(arena.capacity(), 12u);
+
+	for (auto idx = size_t(0); idx < commands.size(); ++idx) {
+		BOOST_CHECK_EQUAL(commands[idx]->value, idx);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ResetReusesStorageAndResetsCommands) {
+	auto arena = Arena();
+
+	auto& first = arena.allocate();
+	first.value = 42u;
+	BOOST_CHECK_EQUAL(first.resetCount, 0u);
+
+	arena.reset();
+	BOOST_CHECK_EQUAL(arena.size(), 0u);
+
+	auto& reused = arena.allocate();
+	BOOST_CHECK_EQUAL(&reused, &first);
+	BOOST_CHECK_EQUAL(reused.value, 0u);
+	BOOST_CHECK_EQUAL(reused.resetCount, 1u);
+
+	auto& fresh = arena.allocate();
+	BOOST_CHECK_EQUAL(fresh.resetCount, 0u);
+	BOOST_CHECK_EQUAL(arena.capacity(), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* CommandArenaTestSuite */);
+
+} // anonymous namespace
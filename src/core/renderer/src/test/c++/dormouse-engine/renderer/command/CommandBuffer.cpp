@@ -0,0 +1,196 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/control/ConstantBuffer.hpp"
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+#if defined(DE_GRAPHICS_NULL)
+
+namespace /* anonymous */ {
+
+// Counts allocations through the global operator new of the test executable. Only done with the null
+// backend, as a real driver may allocate on its own when drawing.
+std::atomic<size_t> heapAllocations = 0u;
+
+} // anonymous namespace
+
+void* operator new(size_t size) {
+	heapAllocations.fetch_add(1u, std::memory_order_relaxed);
+
+	if (auto* memory = std::malloc(size == 0u ? 1u : size)) {
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+#endif /* DE_GRAPHICS_NULL */
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(CommandBufferTestSuite);
+
+BOOST_AUTO_TEST_CASE(ReusesPooledCommandOfPreviousFrame) {
+	auto commandBuffer = CommandBuffer();
+	const auto commandId = CommandBuffer::CommandId{ &commandBuffer, 0u };
+
+	const auto* first = &commandBuffer.create(commandId);
+	commandBuffer.clear();
+	const auto* second = &commandBuffer.create(commandId);
+
+	BOOST_CHECK_EQUAL(first, second);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsPooledCommandsUnusedForAFrame) {
+	auto commandBuffer = CommandBuffer();
+
+	commandBuffer.create(CommandBuffer::CommandId{ &commandBuffer, 0u });
+	commandBuffer.create(CommandBuffer::CommandId{ &commandBuffer, 1u });
+	commandBuffer.clear();
+
+	commandBuffer.create(CommandBuffer::CommandId{ &commandBuffer, 1u });
+	commandBuffer.clear();
+	BOOST_CHECK_EQUAL(commandBuffer.pooledCommandCount(), 2u);
+
+	commandBuffer.clear();
+	BOOST_CHECK_EQUAL(commandBuffer.pooledCommandCount(), 1u);
+
+	commandBuffer.clear();
+	BOOST_CHECK_EQUAL(commandBuffer.pooledCommandCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(PoolsAnyNumberOfCommands) {
+	auto commandBuffer = CommandBuffer();
+
+	for (auto idx = size_t(0); idx < 5000u; ++idx) {
+		commandBuffer.create(CommandBuffer::CommandId{ &commandBuffer, idx });
+	}
+	commandBuffer.sort();
+
+	BOOST_CHECK_EQUAL(commandBuffer.pooledCommandCount(), 5000u);
+	BOOST_CHECK_EQUAL(commandBuffer.sortedCommands().size(), 5000u);
+}
+
+BOOST_AUTO_TEST_CASE(KeepsVertexDataOutOfConstantDataArena) {
+	auto commandBuffer = CommandBuffer();
+
+	auto& command = commandBuffer.create();
+	command.allocateConstantBufferData(graphics::ShaderType::PIXEL, 0u, 16u);
+	command.allocateVertexData(64u);
+
+	BOOST_CHECK_EQUAL(commandBuffer.constantDataArena().size(), 16u);
+	BOOST_CHECK_EQUAL(command.vertexData().size(), 64u);
+}
+
+BOOST_FIXTURE_TEST_CASE(ElidesBindsOfStateBoundInPreviousFrames, tester::RenderingFixture) {
+	auto& commandList = graphicsDevice().getImmediateCommandList();
+	auto commandBuffer = CommandBuffer();
+	const auto technique = shader::Technique();
+
+	const auto recordAndSubmitFrame = [&]() {
+			auto& command = commandBuffer.create();
+			command.setTechnique(essentials::make_observer(&technique));
+			command.setVertexBuffer(graphics::Buffer(), 4u, 0u);
+			command.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+
+			commandBuffer.submit(commandList);
+		};
+
+	recordAndSubmitFrame();
+	BOOST_CHECK_GT(commandBuffer.lastFrameStatistics().binds, 0u);
+
+	recordAndSubmitFrame();
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().binds, 0u);
+
+	commandBuffer.invalidateState();
+	recordAndSubmitFrame();
+	BOOST_CHECK_GT(commandBuffer.lastFrameStatistics().binds, 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(UploadsSharedConstantBufferOncePerContentChangeAcrossFrames, tester::RenderingFixture) {
+	auto& commandList = graphicsDevice().getImmediateCommandList();
+	auto commandBuffer = CommandBuffer();
+	auto sharedConstants = control::ConstantBuffer(graphicsDevice(), 16u);
+	const auto technique = shader::Technique();
+
+	const auto recordAndSubmitFrame = [&]() {
+			auto& command = commandBuffer.create();
+			command.setTechnique(essentials::make_observer(&technique));
+			command.setSharedConstantBuffer(sharedConstants, graphics::ShaderType::VERTEX, 0u);
+			command.setVertexBuffer(graphics::Buffer(), 4u, 0u);
+			command.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+
+			commandBuffer.submit(commandList);
+		};
+
+	recordAndSubmitFrame();
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().sharedUploads, 1u);
+
+	recordAndSubmitFrame();
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().sharedUploads, 0u);
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().elidedSharedUploads, 1u);
+
+	const auto data = std::array<float, 4>{ 1.0f, 2.0f, 3.0f, 4.0f };
+	sharedConstants.update(essentials::viewBuffer(data));
+	recordAndSubmitFrame();
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().sharedUploads, 1u);
+}
+
+#if defined(DE_GRAPHICS_NULL)
+
+BOOST_FIXTURE_TEST_CASE(SubmitsSteadyStateFramesWithoutHeapAllocations, tester::RenderingFixture) {
+	auto& commandList = graphicsDevice().getImmediateCommandList();
+	auto commandBuffer = CommandBuffer();
+	auto sharedConstants = control::ConstantBuffer(graphicsDevice(), 16u);
+	auto constantBuffer = control::createConstantBuffer(graphicsDevice(), 16u);
+	const auto technique = shader::Technique();
+
+	const auto recordAndSubmitFrame = [&]() {
+			for (auto idx = size_t(0); idx < 100u; ++idx) {
+				auto& command = (idx % 2u == 0u) ?
+					commandBuffer.create(CommandBuffer::CommandId{ &commandBuffer, idx }) :
+					commandBuffer.create();
+
+				command.setTechnique(essentials::make_observer(&technique));
+				command.setSharedConstantBuffer(sharedConstants, graphics::ShaderType::VERTEX, 0u);
+				command.setConstantBuffer(constantBuffer, graphics::ShaderType::PIXEL, 0u);
+				command.allocateConstantBufferData(graphics::ShaderType::PIXEL, 0u, 16u).data()[0] =
+					static_cast<essentials::Byte>(idx);
+				command.setVertexBuffer(graphics::Buffer(), 4u, 0u);
+				command.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+			}
+
+			commandBuffer.submit(commandList);
+			commandList.clearCalls();
+		};
+
+	// the first frames grow the arenas, pools and binding tables
+	for (auto frameIdx = 0; frameIdx < 3; ++frameIdx) {
+		recordAndSubmitFrame();
+	}
+
+	const auto allocationsBefore = heapAllocations.load(std::memory_order_relaxed);
+	recordAndSubmitFrame();
+	BOOST_CHECK_EQUAL(heapAllocations.load(std::memory_order_relaxed) - allocationsBefore, 0u);
+}
+
+#endif /* DE_GRAPHICS_NULL */
+
+BOOST_AUTO_TEST_SUITE_END(/* CommandBufferTestSuite */);
+
+} // anonymous namespace
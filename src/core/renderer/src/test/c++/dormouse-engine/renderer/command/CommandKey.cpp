@@ -7,6 +7,24 @@ using namespace dormouse_engine::renderer::command;
 
 namespace /* anonymous */ {
 
+struct MaterialFirstLayout {
+
+	static constexpr auto LAYOUT = CommandKeyLayout(
+		{{
+			{ CommandKeyLayout::Field::MATERIAL_ID, 16u },
+			{ CommandKeyLayout::Field::FULLSCREEN_LAYER_ID, 2u },
+			{ CommandKeyLayout::Field::VIEWPORT_ID, 1u },
+			{ CommandKeyLayout::Field::VIEWPORT_LAYER, 2u },
+			{ CommandKeyLayout::Field::TRANSLUCENCY_TYPE, 1u },
+			{ CommandKeyLayout::Field::DEPTH, 8u },
+		}},
+		false
+		);
+
+};
+
+using MaterialFirstCommandKey = BasicCommandKey<MaterialFirstLayout>;
+
 BOOST_AUTO_TEST_SUITE(CommandKeyTestSuite);
 
 BOOST_AUTO_TEST_CASE(CommandKeyOrdering) {
@@ -23,6 +41,98 @@ BOOST_AUTO_TEST_CASE(CommandKeyOrdering) {
 	BOOST_CHECK(lower.hash() < midLower.hash());
 	BOOST_CHECK(midLower.hash() < midHigher.hash());
 	BOOST_CHECK(midHigher.hash() < higher.hash());
+
+	BOOST_CHECK(lower < midLower);
+	BOOST_CHECK(!(midLower < lower));
+}
+
+BOOST_AUTO_TEST_CASE(EncodingIsIndependentOfCompiler) {
+	constexpr auto key = CommandKey(
+		FullscreenLayerId::HUD,
+		ViewportId::FULLSCREEN,
+		ViewportLayer::WORLD,
+		TranslucencyType::OPAQUE,
+		0,
+		0x12345678u
+		);
+
+	static_assert(key.hash() == 0x4280000012345678ull);
+	BOOST_CHECK_EQUAL(key.hash(), 0x4280000012345678ull);
+}
+
+BOOST_AUTO_TEST_CASE(FieldsRoundTrip) {
+	auto key = CommandKey(
+		FullscreenLayerId::FULLSCREEN_EFFECT,
+		ViewportId::FULLSCREEN,
+		ViewportLayer::EFFECT,
+		TranslucencyType::TRANSLUCENT,
+		-1234,
+		42u
+		);
+
+	BOOST_CHECK(key.fullscreenLayerId() == FullscreenLayerId::FULLSCREEN_EFFECT);
+	BOOST_CHECK(key.viewportId() == ViewportId::FULLSCREEN);
+	BOOST_CHECK(key.viewportLayer() == ViewportLayer::EFFECT);
+	BOOST_CHECK(key.translucencyType() == TranslucencyType::TRANSLUCENT);
+	BOOST_CHECK_EQUAL(key.depth(), -1234);
+	BOOST_CHECK_EQUAL(key.materialId(), 42u);
+
+	key.setTranslucencyType(TranslucencyType::OPAQUE);
+	BOOST_CHECK_EQUAL(key.depth(), -1234);
+}
+
+BOOST_AUTO_TEST_CASE(OpaqueCommandsAreSortedFrontToBack) {
+	auto nearKey = CommandKey();
+	auto farKey = CommandKey();
+
+	nearKey.setDepth(-10);
+	farKey.setDepth(10);
+
+	BOOST_CHECK(nearKey < farKey);
+}
+
+BOOST_AUTO_TEST_CASE(TranslucentCommandsAreSortedBackToFront) {
+	auto nearKey = CommandKey();
+	auto farKey = CommandKey();
+
+	nearKey.setTranslucencyType(TranslucencyType::TRANSLUCENT);
+	nearKey.setDepth(-10);
+	farKey.setTranslucencyType(TranslucencyType::TRANSLUCENT);
+	farKey.setDepth(10);
+
+	BOOST_CHECK(farKey < nearKey);
+}
+
+BOOST_AUTO_TEST_CASE(DepthIsClampedToLayoutRange) {
+	auto key = CommandKey();
+
+	key.setDepth(1 << 30);
+	BOOST_CHECK_EQUAL(key.depth(), (1 << (DEPTH_BITS - 1)) - 1);
+
+	key.setDepth(-(1 << 30));
+	BOOST_CHECK_EQUAL(key.depth(), -(1 << (DEPTH_BITS - 1)));
+}
+
+BOOST_AUTO_TEST_CASE(LayoutDefinesFieldOrder) {
+	auto lowMaterialHud = MaterialFirstCommandKey();
+	auto highMaterialGame = MaterialFirstCommandKey();
+
+	lowMaterialHud.setMaterialId(1u);
+	lowMaterialHud.setFullscreenLayerId(FullscreenLayerId::HUD);
+	highMaterialGame.setMaterialId(2u);
+	highMaterialGame.setFullscreenLayerId(FullscreenLayerId::GAME);
+
+	BOOST_CHECK(lowMaterialHud < highMaterialGame);
+
+	auto translucentNear = MaterialFirstCommandKey();
+	auto translucentFar = MaterialFirstCommandKey();
+
+	translucentNear.setTranslucencyType(TranslucencyType::TRANSLUCENT);
+	translucentNear.setDepth(-10);
+	translucentFar.setTranslucencyType(TranslucencyType::TRANSLUCENT);
+	translucentFar.setDepth(10);
+
+	BOOST_CHECK(translucentNear < translucentFar);
 }
 
 BOOST_AUTO_TEST_SUITE_END(/* CommandKeyTestSuite */);
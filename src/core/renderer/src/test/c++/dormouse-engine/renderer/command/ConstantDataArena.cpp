@@ -0,0 +1,60 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <algorithm>
+
+#include "dormouse-engine/renderer/command/ConstantDataArena.hpp"
+
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(ConstantDataArenaTestSuite);
+
+BOOST_AUTO_TEST_CASE(AllocationsAreAlignedAndDoNotOverlap) {
+	auto arena = ConstantDataArena();
+
+	const auto first = arena.allocate(20u);
+	const auto second = arena.allocate(64u);
+
+	BOOST_CHECK_EQUAL(first.offset, 0u);
+	BOOST_CHECK_EQUAL(first.size, 20u);
+	BOOST_CHECK_EQUAL(second.offset % ConstantDataArena::ALIGNMENT, 0u);
+	BOOST_CHECK_GE(second.offset, first.offset + first.size);
+	BOOST_CHECK_EQUAL(arena.size(), second.offset + second.size);
+}
+
+BOOST_AUTO_TEST_CASE(DataSurvivesArenaGrowth) {
+	auto arena = ConstantDataArena();
+
+	const auto first = arena.allocate(4u);
+	auto firstView = arena.view(first);
+	std::fill(firstView.data(), firstView.data() + firstView.size(), std::uint8_t(42));
+
+	for (auto idx = 0; idx < 100; ++idx) {
+		arena.allocate(256u);
+	}
+
+	const auto& constArena = arena;
+	const auto data = constArena.view(first);
+	BOOST_CHECK(std::all_of(data.data(), data.data() + data.size(), [](auto byte) { return byte == 42; }));
+}
+
+BOOST_AUTO_TEST_CASE(ResetKeepsCapacityAndZeroFillsNewAllocations) {
+	auto arena = ConstantDataArena();
+
+	auto view = arena.view(arena.allocate(128u));
+	std::fill(view.data(), view.data() + view.size(), std::uint8_t(0xff));
+	const auto capacity = arena.capacity();
+
+	arena.reset();
+	BOOST_CHECK_EQUAL(arena.size(), 0u);
+	BOOST_CHECK_EQUAL(arena.capacity(), capacity);
+
+	const auto data = arena.view(arena.allocate(128u));
+	BOOST_CHECK(std::all_of(data.data(), data.data() + data.size(), [](auto byte) { return byte == 0; }));
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* ConstantDataArenaTestSuite */);
+
+} // anonymous namespace
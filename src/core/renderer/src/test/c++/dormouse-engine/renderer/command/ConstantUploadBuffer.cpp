@@ -0,0 +1,62 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <cstdint>
+
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/ConstantUploadBuffer.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+BOOST_FIXTURE_TEST_SUITE(ConstantUploadBufferTestSuite, tester::RenderingFixture);
+
+BOOST_AUTO_TEST_CASE(StagesArenasAtAlignedOffsets) {
+	auto uploadBuffer = ConstantUploadBuffer(graphicsDevice(), 256u);
+
+	auto first = ConstantDataArena();
+	first.allocate(20u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	first.allocate(64u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+
+	auto second = ConstantDataArena();
+	second.allocate(16u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+
+	const auto empty = ConstantDataArena();
+
+	uploadBuffer.stage(first);
+	uploadBuffer.stage(empty);
+	uploadBuffer.stage(second);
+
+	BOOST_REQUIRE(uploadBuffer.offset(first));
+	BOOST_REQUIRE(uploadBuffer.offset(second));
+	BOOST_CHECK_EQUAL(*uploadBuffer.offset(first), 0u);
+	BOOST_CHECK_EQUAL(*uploadBuffer.offset(second), 2u * graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	BOOST_CHECK(!uploadBuffer.offset(empty));
+	BOOST_CHECK_EQUAL(uploadBuffer.size(), 3u * graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	BOOST_CHECK_EQUAL(ConstantUploadBuffer::rangeSize(20u), graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+
+	uploadBuffer.reset();
+	BOOST_CHECK(!uploadBuffer.offset(first));
+	BOOST_CHECK_EQUAL(uploadBuffer.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GrowsToFitStagedData) {
+	auto uploadBuffer = ConstantUploadBuffer(graphicsDevice(), 256u);
+
+	auto arena = ConstantDataArena();
+	for (auto idx = 0; idx < 4; ++idx) {
+		arena.allocate(64u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	}
+
+	uploadBuffer.stage(arena);
+
+	BOOST_CHECK_EQUAL(uploadBuffer.upload(graphicsDevice().getImmediateCommandList()), 1024u);
+	BOOST_CHECK_GE(uploadBuffer.capacity(), 1024u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* ConstantUploadBufferTestSuite */);
+
+} // anonymous namespace
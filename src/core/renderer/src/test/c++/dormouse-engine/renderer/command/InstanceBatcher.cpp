@@ -0,0 +1,132 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <cstdint>
+
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/control/Sampler.hpp"
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+const auto INSTANCE_STRIDE = size_t(16);
+
+class InstanceBatcherFixture : public tester::RenderingFixture {
+public:
+
+	DrawCommand& record(
+		CommandBuffer& commandBuffer, const control::Sampler& sampler, size_t instanceCapacity, float value) const
+	{
+		auto& cmd = commandBuffer.create();
+
+		cmd.setTechnique(essentials::make_observer(&technique_));
+		cmd.setSampler(sampler, graphics::ShaderType::PIXEL, 0u);
+		cmd.setVertexBuffer(graphics::Buffer(), 4u, 0u);
+		cmd.setIndexBuffer(graphics::Buffer(), 4u, 2u);
+		cmd.setPrimitiveTopology(graphics::PrimitiveTopology::TRIANGLE_STRIP);
+		cmd.setInstanceBuffer(instanceBuffer_, instanceCapacity, INSTANCE_STRIDE);
+		*reinterpret_cast<float*>(cmd.allocateInstanceData().data()) = value;
+
+		return cmd;
+	}
+
+	const control::Sampler linear = control::Sampler(graphicsDevice(), control::Sampler::WRAPPED_LINEAR);
+
+	const control::Sampler clamped = control::Sampler(graphicsDevice(), control::Sampler::CLAMPED_LINEAR);
+
+private:
+
+	shader::Technique technique_;
+
+	graphics::Buffer instanceBuffer_ = createInstanceBuffer_(graphicsDevice());
+
+	static graphics::Buffer createInstanceBuffer_(graphics::Device& graphicsDevice) {
+		auto configuration = graphics::Buffer::Configuration();
+		configuration.allowCPURead = false;
+		configuration.allowGPUWrite = false;
+		configuration.allowModifications = true;
+		configuration.purpose = graphics::Buffer::CreationPurpose::VERTEX_BUFFER;
+		configuration.size = 16u * INSTANCE_STRIDE;
+		return graphics::Buffer(graphicsDevice, configuration);
+	}
+
+};
+
+BOOST_FIXTURE_TEST_SUITE(InstanceBatcherTestSuite, InstanceBatcherFixture);
+
+BOOST_AUTO_TEST_CASE(DrawsCompatibleCommandsWithSingleInstancedDraw) {
+	auto commandBuffer = CommandBuffer();
+
+	for (auto idx = 0; idx < 5; ++idx) {
+		record(commandBuffer, linear, 16u, static_cast<float>(idx));
+	}
+
+	commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+
+	const auto& statistics = commandBuffer.lastFrameStatistics();
+	BOOST_CHECK_EQUAL(statistics.draws, 1u);
+	BOOST_CHECK_EQUAL(statistics.instancedDraws, 1u);
+	BOOST_CHECK_EQUAL(statistics.instances, 5u);
+	BOOST_CHECK_EQUAL(statistics.uploadedBytes, 5u * INSTANCE_STRIDE);
+}
+
+BOOST_AUTO_TEST_CASE(SplitsRunsOnStateChange) {
+	auto commandBuffer = CommandBuffer();
+
+	record(commandBuffer, linear, 16u, 0.0f);
+	record(commandBuffer, linear, 16u, 1.0f);
+	record(commandBuffer, clamped, 16u, 2.0f);
+	record(commandBuffer, linear, 16u, 3.0f);
+
+	commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+
+	const auto& statistics = commandBuffer.lastFrameStatistics();
+	BOOST_CHECK_EQUAL(statistics.draws, 3u);
+	BOOST_CHECK_EQUAL(statistics.instances, 4u);
+}
+
+BOOST_AUTO_TEST_CASE(SplitsRunsExceedingInstanceCapacity) {
+	auto commandBuffer = CommandBuffer();
+
+	for (auto idx = 0; idx < 5; ++idx) {
+		record(commandBuffer, linear, 2u, static_cast<float>(idx));
+	}
+
+	commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+
+	const auto& statistics = commandBuffer.lastFrameStatistics();
+	BOOST_CHECK_EQUAL(statistics.draws, 3u);
+	BOOST_CHECK_EQUAL(statistics.instances, 5u);
+}
+
+BOOST_AUTO_TEST_CASE(CommandsDifferingInConstantDataAreNotBatched) {
+	auto commandBuffer = CommandBuffer();
+
+	auto constantBufferConfiguration = graphics::Buffer::Configuration();
+	constantBufferConfiguration.allowCPURead = false;
+	constantBufferConfiguration.allowGPUWrite = false;
+	constantBufferConfiguration.allowModifications = true;
+	constantBufferConfiguration.purpose = graphics::Buffer::CreationPurpose::CONSTANT_BUFFER;
+	constantBufferConfiguration.size = 16u;
+	const auto constantBuffer = graphics::Buffer(graphicsDevice(), constantBufferConfiguration);
+
+	for (auto idx = 0; idx < 2; ++idx) {
+		auto& cmd = record(commandBuffer, linear, 16u, 0.0f);
+		cmd.setConstantBuffer(constantBuffer, graphics::ShaderType::VERTEX, 0u);
+		*cmd.allocateConstantBufferData(graphics::ShaderType::VERTEX, 0u, 16u).data() = static_cast<std::uint8_t>(idx);
+	}
+
+	commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().draws, 2u);
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().instancedDraws, 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* InstanceBatcherTestSuite */);
+
+} // anonymous namespace
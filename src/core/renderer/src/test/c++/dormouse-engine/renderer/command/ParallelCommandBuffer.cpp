@@ -0,0 +1,143 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+#include "dormouse-engine/renderer/command/ParallelCommandBuffer.hpp"
+#include "dormouse-engine/renderer/command/CommandKey.hpp"
+#include "dormouse-engine/renderer/control/Control.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+void record(CommandBuffer& commandBuffer, MaterialId materialId) {
+	auto commandKey = CommandKey();
+	commandKey.setMaterialId(materialId);
+
+	auto renderControl = control::Control(
+		commandKey,
+		control::DepthStencilView(),
+		control::RenderTargetView(),
+		control::Viewport(),
+		control::RenderState()
+		);
+
+	commandBuffer.create().setRenderControl(renderControl);
+}
+
+std::vector<MaterialId> sortedMaterialIds(ParallelCommandBuffer& parallelCommandBuffer) {
+	auto materialIds = std::vector<MaterialId>();
+	parallelCommandBuffer.forEachSorted([&materialIds](const DrawCommand& command) {
+			materialIds.emplace_back(command.key().materialId());
+		});
+	return materialIds;
+}
+
+BOOST_AUTO_TEST_SUITE(ParallelCommandBufferTestSuite);
+
+BOOST_AUTO_TEST_CASE(MergesThreadBuffersInKeyOrder) {
+	const auto THREAD_COUNT = size_t(4);
+	const auto COMMANDS_PER_THREAD = MaterialId(100);
+
+	auto parallelCommandBuffer = ParallelCommandBuffer(THREAD_COUNT);
+
+	auto threads = std::vector<std::thread>();
+	for (auto threadIdx = size_t(0); threadIdx < THREAD_COUNT; ++threadIdx) {
+		threads.emplace_back([&parallelCommandBuffer, threadIdx, COMMANDS_PER_THREAD]() {
+				auto& commandBuffer = parallelCommandBuffer.threadBuffer(threadIdx);
+				for (auto idx = MaterialId(0); idx < COMMANDS_PER_THREAD; ++idx) {
+					// interleaves materials between threads and records them in descending order
+					const auto materialId = (COMMANDS_PER_THREAD - idx - 1) * THREAD_COUNT + threadIdx;
+					record(commandBuffer, static_cast<MaterialId>(materialId));
+				}
+				commandBuffer.sort();
+			});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	const auto materialIds = sortedMaterialIds(parallelCommandBuffer);
+
+	BOOST_REQUIRE_EQUAL(materialIds.size(), THREAD_COUNT * COMMANDS_PER_THREAD);
+	for (auto idx = size_t(0); idx < materialIds.size(); ++idx) {
+		BOOST_CHECK_EQUAL(materialIds[idx], idx);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SortsBuffersNotSortedByRecordingThreads) {
+	auto parallelCommandBuffer = ParallelCommandBuffer(2u);
+
+	record(parallelCommandBuffer.threadBuffer(0u), 3u);
+	record(parallelCommandBuffer.threadBuffer(0u), 1u);
+	record(parallelCommandBuffer.threadBuffer(1u), 2u);
+	record(parallelCommandBuffer.threadBuffer(1u), 0u);
+
+	const auto materialIds = sortedMaterialIds(parallelCommandBuffer);
+	const auto expected = std::vector<MaterialId>{ 0u, 1u, 2u, 3u };
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(materialIds.begin(), materialIds.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(LeasesEachBufferOnceAtATime) {
+	auto parallelCommandBuffer = ParallelCommandBuffer(2u);
+
+	auto first = parallelCommandBuffer.lease();
+
+	{
+		auto second = parallelCommandBuffer.lease();
+
+		BOOST_CHECK(&first.buffer() != &second.buffer());
+		BOOST_CHECK_THROW(parallelCommandBuffer.lease(), exceptions::LogicError);
+	}
+
+	auto third = parallelCommandBuffer.lease();
+	BOOST_CHECK(&first.buffer() != &third.buffer());
+}
+
+BOOST_AUTO_TEST_CASE(KeepsCommandsRecordedThroughReleasedLeases) {
+	const auto THREAD_COUNT = size_t(2);
+
+	auto parallelCommandBuffer = ParallelCommandBuffer(THREAD_COUNT);
+
+	auto threads = std::vector<std::thread>();
+	for (auto threadIdx = size_t(0); threadIdx < THREAD_COUNT; ++threadIdx) {
+		threads.emplace_back([&parallelCommandBuffer, threadIdx]() {
+				auto lease = parallelCommandBuffer.lease();
+				record(lease.buffer(), static_cast<MaterialId>(threadIdx));
+			});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	auto lease = parallelCommandBuffer.lease();
+	record(lease.buffer(), static_cast<MaterialId>(THREAD_COUNT));
+
+	const auto materialIds = sortedMaterialIds(parallelCommandBuffer);
+	const auto expected = std::vector<MaterialId>{ 0u, 1u, 2u };
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(materialIds.begin(), materialIds.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(ClearDropsCommandsOfAllBuffers) {
+	auto parallelCommandBuffer = ParallelCommandBuffer(2u);
+
+	record(parallelCommandBuffer.threadBuffer(0u), 0u);
+	record(parallelCommandBuffer.threadBuffer(1u), 1u);
+
+	parallelCommandBuffer.clear();
+
+	BOOST_CHECK(sortedMaterialIds(parallelCommandBuffer).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* ParallelCommandBufferTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,229 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/command/ConstantDataArena.hpp"
+#include "dormouse-engine/renderer/command/ConstantUploadBuffer.hpp"
+#include "dormouse-engine/renderer/command/StateCache.hpp"
+#include "dormouse-engine/renderer/control/ConstantBuffer.hpp"
+#include "dormouse-engine/renderer/control/RenderState.hpp"
+#include "dormouse-engine/renderer/control/Sampler.hpp"
+#include "dormouse-engine/renderer/shader/PipelineState.hpp"
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::command;
+
+namespace /* anonymous */ {
+
+graphics::Buffer createConstantBuffer(graphics::Device& graphicsDevice, size_t size) {
+	auto configuration = graphics::Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = graphics::Buffer::CreationPurpose::CONSTANT_BUFFER;
+	configuration.size = size;
+	return graphics::Buffer(graphicsDevice, configuration);
+}
+
+BOOST_FIXTURE_TEST_SUITE(StateCacheTestSuite, tester::RenderingFixture);
+
+BOOST_AUTO_TEST_CASE(ElidesRepeatedBinds) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	const auto linear = control::Sampler(graphicsDevice(), control::Sampler::WRAPPED_LINEAR);
+	const auto clamped = control::Sampler(graphicsDevice(), control::Sampler::CLAMPED_LINEAR);
+	const auto renderState = control::RenderState(graphicsDevice(), control::RenderState::OPAQUE);
+
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 1u);
+	stateCache.setSampler(clamped, graphics::ShaderType::PIXEL, 0u);
+	stateCache.setRenderState(renderState);
+	stateCache.setRenderState(renderState);
+	stateCache.setViewport(fullscreenViewport());
+	stateCache.setViewport(fullscreenViewport());
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 5u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedBinds, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidateForgetsBoundState) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	stateCache.setViewport(fullscreenViewport());
+	stateCache.invalidate();
+	stateCache.setViewport(fullscreenViewport());
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 2u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedBinds, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ElidesUploadsOfEqualContent) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	auto first = createConstantBuffer(graphicsDevice(), 16u);
+	auto second = createConstantBuffer(graphicsDevice(), 16u);
+
+	auto data = std::array<float, 4>{ 1.0f, 2.0f, 3.0f, 4.0f };
+
+	stateCache.uploadConstantBufferData(first, essentials::viewBuffer(data));
+	stateCache.uploadConstantBufferData(first, essentials::viewBuffer(data));
+	stateCache.uploadConstantBufferData(second, essentials::viewBuffer(data));
+
+	data[3] = 5.0f;
+	stateCache.uploadConstantBufferData(first, essentials::viewBuffer(data));
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().uploads, 3u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedUploads, 1u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().uploadedBytes, 3u * sizeof(data));
+}
+
+BOOST_AUTO_TEST_CASE(UploadsSharedConstantBufferOncePerContentChange) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	auto constantBuffer = control::ConstantBuffer(graphicsDevice(), 16u);
+	const auto copy = constantBuffer;
+
+	auto data = std::array<float, 4>{ 1.0f, 2.0f, 3.0f, 4.0f };
+
+	constantBuffer.update(essentials::viewBuffer(data));
+	stateCache.uploadConstantBuffer(constantBuffer);
+	stateCache.uploadConstantBuffer(copy);
+
+	constantBuffer.update(essentials::viewBuffer(data));
+	stateCache.uploadConstantBuffer(constantBuffer);
+
+	data[3] = 5.0f;
+	constantBuffer.update(essentials::viewBuffer(data));
+	BOOST_CHECK_EQUAL(copy.contentHash(), constantBuffer.contentHash());
+	stateCache.uploadConstantBuffer(constantBuffer);
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().sharedUploads, 2u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedSharedUploads, 2u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().sharedUploadedBytes, 2u * sizeof(data));
+	BOOST_CHECK_EQUAL(stateCache.statistics().uploads, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(BindsRangesOfStagedConstantData) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+	auto uploadBuffer = ConstantUploadBuffer(graphicsDevice());
+	const auto fallback = createConstantBuffer(graphicsDevice(), 16u);
+
+	auto arena = ConstantDataArena();
+	const auto first = arena.allocate(16u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	const auto second = arena.allocate(16u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+	auto notStaged = ConstantDataArena();
+	const auto third = notStaged.allocate(16u, graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+
+	uploadBuffer.stage(arena);
+	stateCache.uploadStagedConstantData(uploadBuffer);
+
+	stateCache.setConstantData(fallback, arena, first, graphics::ShaderType::VERTEX, 0u);
+	stateCache.setConstantData(fallback, arena, first, graphics::ShaderType::VERTEX, 0u);
+	stateCache.setConstantData(fallback, arena, second, graphics::ShaderType::VERTEX, 0u);
+	stateCache.setConstantData(fallback, notStaged, third, graphics::ShaderType::VERTEX, 0u);
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().uploads, 2u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().uploadedBytes, 2u * graphics::CONSTANT_BUFFER_OFFSET_ALIGNMENT + 16u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 3u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedBinds, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(UnbindsSlotsLeftEmptyByNextBindingSet) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	const auto linear = control::Sampler(graphicsDevice(), control::Sampler::WRAPPED_LINEAR);
+	const auto constantBuffer = createConstantBuffer(graphicsDevice(), 16u);
+
+	stateCache.beginBindings();
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 1u);
+	stateCache.setConstantBuffer(constantBuffer, graphics::ShaderType::VERTEX, 0u);
+	stateCache.endBindings();
+
+	stateCache.beginBindings();
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.endBindings();
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 3u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedBinds, 1u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().unbinds, 2u);
+
+	stateCache.beginBindings();
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 1u);
+	stateCache.endBindings();
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 4u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().unbinds, 3u);
+}
+
+#if defined(DE_GRAPHICS_NULL)
+
+BOOST_AUTO_TEST_CASE(IssuesOnlyCallsThatChangeState) {
+	using CallType = graphics::CommandList::CallType;
+
+	auto& commandList = graphicsDevice().getImmediateCommandList();
+	auto stateCache = StateCache(commandList);
+
+	const auto linear = control::Sampler(graphicsDevice(), control::Sampler::WRAPPED_LINEAR);
+	const auto renderState = control::RenderState(graphicsDevice(), control::RenderState::OPAQUE);
+	const auto constantBuffer = createConstantBuffer(graphicsDevice(), 16u);
+
+	commandList.clearCalls();
+
+	stateCache.beginBindings();
+	stateCache.setRenderState(renderState);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 1u);
+	stateCache.setConstantBuffer(constantBuffer, graphics::ShaderType::VERTEX, 0u);
+	stateCache.endBindings();
+
+	stateCache.beginBindings();
+	stateCache.setRenderState(renderState);
+	stateCache.setSampler(linear, graphics::ShaderType::PIXEL, 0u);
+	stateCache.endBindings();
+
+	BOOST_CHECK_EQUAL(commandList.callCount(CallType::SET_RENDER_STATE), 1u);
+	BOOST_CHECK_EQUAL(commandList.callCount(CallType::SET_SAMPLER), 3u); // two binds and one unbind
+	BOOST_CHECK_EQUAL(commandList.callCount(CallType::SET_CONSTANT_BUFFER), 2u); // bind and unbind
+	BOOST_CHECK_EQUAL(commandList.callCount(), 6u);
+}
+
+#endif /* DE_GRAPHICS_NULL */
+
+BOOST_AUTO_TEST_CASE(BindsPipelineStateAsOne) {
+	auto stateCache = StateCache(graphicsDevice().getImmediateCommandList());
+
+	const auto opaque = control::RenderState(graphicsDevice(), control::RenderState::OPAQUE);
+	const auto wireframe = control::RenderState(graphicsDevice(), graphics::RenderState::Configuration{
+		graphics::RenderState::CullMode::NONE, graphics::RenderState::FillMode::WIREFRAME, false, false });
+
+	auto first = shader::Technique();
+	first.setShader(shader::VertexShader());
+	first.setShader(shader::PixelShader());
+	auto second = shader::Technique();
+	second.setShader(shader::VertexShader());
+
+	BOOST_CHECK(shader::PipelineState(first, opaque) == shader::PipelineState(first, opaque));
+	BOOST_CHECK(shader::PipelineState(first, opaque) != shader::PipelineState(first, wireframe));
+	BOOST_CHECK(shader::PipelineState(first, opaque) != shader::PipelineState(second, opaque));
+
+	stateCache.setPipelineState(shader::PipelineState(first, opaque));
+	stateCache.setPipelineState(shader::PipelineState(first, opaque));
+	stateCache.setPipelineState(shader::PipelineState(first, wireframe));
+	stateCache.setPipelineState(shader::PipelineState(second, wireframe));
+	stateCache.setRenderState(wireframe);
+	stateCache.setTechnique(second);
+
+	BOOST_CHECK_EQUAL(stateCache.statistics().binds, 3u);
+	BOOST_CHECK_EQUAL(stateCache.statistics().elidedBinds, 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* StateCacheTestSuite */);
+
+} // anonymous namespace
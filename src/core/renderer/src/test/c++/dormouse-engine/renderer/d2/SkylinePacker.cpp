@@ -0,0 +1,140 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+#include "dormouse-engine/renderer/d2/SkylinePacker.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+namespace /* anonymous */ {
+
+// Uses the raw engine output rather than a distribution, as distributions aren't required to give the same
+// results across standard library implementations.
+std::vector<SkylinePacker::Size> randomSizes(size_t count, size_t minSize, size_t maxSize) {
+	auto engine = std::minstd_rand(12345u);
+	const auto range = maxSize - minSize + 1u;
+
+	auto sizes = std::vector<SkylinePacker::Size>();
+	for (auto idx = size_t(0); idx < count; ++idx) {
+		const auto width = minSize + engine() % range;
+		const auto height = minSize + engine() % range;
+		sizes.emplace_back(SkylinePacker::Size{ width, height });
+	}
+
+	return sizes;
+}
+
+bool overlap(const SkylinePacker::Rect& lhs, const SkylinePacker::Rect& rhs, size_t padding) {
+	return
+		lhs.x < rhs.x + rhs.width + padding && rhs.x < lhs.x + lhs.width + padding &&
+		lhs.y < rhs.y + rhs.height + padding && rhs.y < lhs.y + lhs.height + padding;
+}
+
+void checkPlacement(
+	const SkylinePacker& packer,
+	const std::vector<SkylinePacker::Size>& sizes,
+	const std::vector<SkylinePacker::Rect>& rects,
+	size_t padding
+	)
+{
+	BOOST_REQUIRE_EQUAL(rects.size(), sizes.size());
+
+	for (auto idx = size_t(0); idx < rects.size(); ++idx) {
+		BOOST_CHECK_EQUAL(rects[idx].width, sizes[idx].width);
+		BOOST_CHECK_EQUAL(rects[idx].height, sizes[idx].height);
+		BOOST_CHECK_LE(rects[idx].x + rects[idx].width, packer.width());
+		BOOST_CHECK_LE(rects[idx].y + rects[idx].height, packer.height());
+
+		for (auto otherIdx = idx + 1u; otherIdx < rects.size(); ++otherIdx) {
+			BOOST_CHECK(!overlap(rects[idx], rects[otherIdx], padding));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(SkylinePackerTestSuite);
+
+BOOST_AUTO_TEST_CASE(PlacesRectanglesBottomLeft) {
+	auto packer = SkylinePacker(8u, 8u);
+
+	const auto first = packer.insert(4u, 2u);
+	const auto second = packer.insert(4u, 4u);
+	const auto third = packer.insert(4u, 2u);
+
+	BOOST_REQUIRE(first && second && third);
+	BOOST_CHECK_EQUAL(first->x, 0u);
+	BOOST_CHECK_EQUAL(first->y, 0u);
+	BOOST_CHECK_EQUAL(second->x, 4u);
+	BOOST_CHECK_EQUAL(second->y, 0u);
+	BOOST_CHECK_EQUAL(third->x, 0u);
+	BOOST_CHECK_EQUAL(third->y, 2u);
+	BOOST_CHECK_EQUAL(packer.usedArea(), 32u);
+}
+
+BOOST_AUTO_TEST_CASE(FillsBinWithEqualRectangles) {
+	auto packer = SkylinePacker(64u, 64u);
+
+	const auto sizes = std::vector<SkylinePacker::Size>(64u, SkylinePacker::Size{ 8u, 8u });
+	const auto rects = packer.insert(sizes);
+
+	BOOST_REQUIRE(rects);
+	checkPlacement(packer, sizes, *rects, 0u);
+	BOOST_CHECK_EQUAL(packer.occupancy(), 1.0f);
+	BOOST_CHECK(!packer.insert(1u, 1u));
+}
+
+BOOST_AUTO_TEST_CASE(RejectsRectanglesNotFitting) {
+	auto packer = SkylinePacker(16u, 16u, 1u);
+
+	BOOST_CHECK(!packer.insert(17u, 1u));
+	BOOST_CHECK(packer.insert(16u, 8u));
+	BOOST_CHECK(!packer.insert(16u, 8u));
+	BOOST_CHECK(packer.insert(16u, 7u));
+}
+
+BOOST_AUTO_TEST_CASE(KeepsPaddingBetweenRectangles) {
+	const auto padding = size_t(2);
+	auto packer = SkylinePacker(256u, 256u, padding);
+
+	const auto sizes = randomSizes(100u, 4u, 24u);
+	const auto rects = packer.insert(sizes);
+
+	BOOST_REQUIRE(rects);
+	checkPlacement(packer, sizes, *rects, padding);
+}
+
+BOOST_AUTO_TEST_CASE(PacksRandomRectanglesDensely) {
+	auto packer = SkylinePacker(512u, 512u);
+
+	// average area of 400 texels, 620 rectangles cover around 95% of the bin
+	const auto sizes = randomSizes(620u, 8u, 32u);
+	const auto rects = packer.insert(sizes);
+
+	BOOST_REQUIRE(rects);
+	checkPlacement(packer, sizes, *rects, 0u);
+	BOOST_CHECK_GT(packer.occupancy(), 0.9f);
+}
+
+BOOST_AUTO_TEST_CASE(PackingIsDeterministic) {
+	const auto sizes = randomSizes(200u, 4u, 40u);
+
+	auto packer = SkylinePacker(512u, 512u, 1u);
+	const auto rects = packer.insert(sizes);
+	BOOST_REQUIRE(rects);
+
+	packer.clear();
+	const auto repeated = packer.insert(sizes);
+	BOOST_REQUIRE(repeated);
+
+	for (auto idx = size_t(0); idx < sizes.size(); ++idx) {
+		BOOST_CHECK_EQUAL((*rects)[idx].x, (*repeated)[idx].x);
+		BOOST_CHECK_EQUAL((*rects)[idx].y, (*repeated)[idx].y);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* SkylinePackerTestSuite */);
+
+} // anonymous namespace
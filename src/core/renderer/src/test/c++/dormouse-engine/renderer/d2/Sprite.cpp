@@ -8,6 +8,7 @@
 #include "dormouse-engine/renderer/d2/Sprite.hpp"
 #include "dormouse-engine/renderer/command/CommandKey.hpp"
 #include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/command/DrawCommand.hpp"
 #include "dormouse-engine/renderer/control/Control.hpp"
 #include "dormouse-engine/renderer/control/RenderState.hpp"
 
@@ -69,6 +70,33 @@ BOOST_AUTO_TEST_CASE(RendersSprites) {
 	compareWithReferenceScreen(0);
 }
 
+BOOST_AUTO_TEST_CASE(BindsViewTransformAsSharedConstantBuffer) {
+	auto texturePath = "test/renderer/sprite-texture.png"s;
+	auto textureData = essentials::test_utils::readBinaryFile(texturePath);
+	auto textureImage = graphics::Image::load(essentials::viewBuffer(textureData), texturePath);
+	auto texture = graphics::Texture(graphicsDevice(), textureImage);
+	auto sprite = Sprite(texture);
+
+	const auto renderControl = control::Control(
+		command::CommandKey(),
+		graphicsDevice().depthStencil(),
+		graphicsDevice().backBuffer(),
+		fullscreenViewport(),
+		control::RenderState(graphicsDevice(), control::RenderState::OPAQUE)
+		);
+
+	auto commandBuffer = command::CommandBuffer();
+	sprite.render(commandBuffer, shader::Property(), renderControl);
+	commandBuffer.sort();
+
+	BOOST_REQUIRE_EQUAL(commandBuffer.sortedCommands().size(), 1u);
+	const auto& cmd = *commandBuffer.sortedCommands().front().command;
+
+	BOOST_CHECK_EQUAL(cmd.sharedConstantBuffers().size(), 1u);
+	BOOST_CHECK(cmd.sharedConstantBuffers().front().stage == graphics::ShaderType::VERTEX);
+	BOOST_CHECK(cmd.constantBuffers().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END(/* RendererSpriteTestSuite */);
 
 } // anonymous namespace
@@ -0,0 +1,133 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <vector>
+
+#include "dormouse-engine/graphics/Image.hpp"
+#include "dormouse-engine/essentials/test-utils/test-utils.hpp"
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/d2/SpriteBatch.hpp"
+#include "dormouse-engine/renderer/command/CommandKey.hpp"
+#include "dormouse-engine/renderer/command/CommandBuffer.hpp"
+#include "dormouse-engine/renderer/control/Control.hpp"
+#include "dormouse-engine/renderer/control/RenderState.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+using namespace std::string_literals;
+
+namespace /* anonymous */ {
+
+class SpriteBatchFixture : public tester::RenderingFixture {
+public:
+
+	graphics::Texture loadTexture() {
+		const auto texturePath = "test/renderer/sprite-texture.png"s;
+		const auto textureData = essentials::test_utils::readBinaryFile(texturePath);
+		const auto textureImage = graphics::Image::load(essentials::viewBuffer(textureData), texturePath);
+		return graphics::Texture(graphicsDevice(), textureImage);
+	}
+
+	// Lays out count sprites in a row along the bottom of the screen
+	std::vector<Sprite> createSprites(const graphics::Texture& texture, size_t count) {
+		auto sprites = std::vector<Sprite>(count, Sprite(texture));
+
+		for (auto idx = size_t(0); idx < count; ++idx) {
+			auto& layout = sprites[idx].layout();
+			layout.size().x() = Ndc(0.25f);
+			layout.size().y() = RatioKeeping(essentials::make_observer(&layout.size().x()), 0.5f);
+			layout.anchor() = Layout::Anchor(Layout::HorizontalAnchor::LEFT, Layout::VerticalAnchor::BOTTOM);
+			layout.position() = Layout::Position(WindowRelative(0.125f * static_cast<float>(idx)), WindowRelative(0.0f));
+		}
+
+		return sprites;
+	}
+
+	void renderBatch(SpriteBatch& spriteBatch, command::CommandBuffer& commandBuffer) {
+		graphicsDevice().beginScene();
+
+		spriteBatch.render(graphicsDevice(), commandBuffer, shader::Property(), renderControl_);
+		commandBuffer.submit(graphicsDevice().getImmediateCommandList());
+
+		graphicsDevice().endScene();
+	}
+
+private:
+
+	control::Control renderControl_ = control::Control(
+		command::CommandKey(
+			command::FullscreenLayerId::HUD,
+			command::ViewportId::FULLSCREEN,
+			command::ViewportLayer::HUD,
+			command::TranslucencyType::OPAQUE,
+			0,
+			0
+			),
+		graphicsDevice().depthStencil(),
+		graphicsDevice().backBuffer(),
+		fullscreenViewport(),
+		control::RenderState(graphicsDevice(), control::RenderState::OPAQUE)
+		);
+
+};
+
+BOOST_FIXTURE_TEST_SUITE(RendererSpriteBatchTestSuite, SpriteBatchFixture);
+
+BOOST_AUTO_TEST_CASE(RendersSpritesSharingTextureWithSingleDraw) {
+	const auto texture = loadTexture();
+	const auto sprites = createSprites(texture, 8u);
+
+	auto spriteBatch = SpriteBatch(graphicsDevice());
+	for (const auto& sprite : sprites) {
+		spriteBatch.add(sprite);
+	}
+
+	auto commandBuffer = command::CommandBuffer();
+	renderBatch(spriteBatch, commandBuffer);
+
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().draws, 1u);
+	BOOST_CHECK_EQUAL(spriteBatch.size(), 0u);
+
+	compareWithReferenceScreen(0);
+}
+
+BOOST_AUTO_TEST_CASE(DrawsOncePerTexture) {
+	const auto first = loadTexture();
+	const auto second = loadTexture();
+	const auto firstSprites = createSprites(first, 4u);
+	const auto secondSprites = createSprites(second, 4u);
+
+	auto spriteBatch = SpriteBatch(graphicsDevice());
+	for (auto idx = size_t(0); idx < 4u; ++idx) {
+		spriteBatch.add(firstSprites[idx]);
+		spriteBatch.add(secondSprites[idx]);
+	}
+
+	auto commandBuffer = command::CommandBuffer();
+	renderBatch(spriteBatch, commandBuffer);
+
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().draws, 2u);
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().vertexBufferDiscards, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(GrowsRingBufferForLargeBatches) {
+	const auto texture = loadTexture();
+	const auto sprites = createSprites(texture, 5u);
+
+	auto spriteBatch = SpriteBatch(graphicsDevice(), 2u);
+	for (const auto& sprite : sprites) {
+		spriteBatch.add(sprite);
+	}
+
+	auto commandBuffer = command::CommandBuffer();
+	renderBatch(spriteBatch, commandBuffer);
+
+	BOOST_CHECK_GE(spriteBatch.capacity(), 5u);
+	BOOST_CHECK_EQUAL(commandBuffer.lastFrameStatistics().draws, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererSpriteBatchTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,96 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+#include "dormouse-engine/exceptions/RuntimeError.hpp"
+#include "dormouse-engine/graphics/Image.hpp"
+#include "dormouse-engine/renderer/d2/TextureAtlas.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::d2;
+
+namespace /* anonymous */ {
+
+const auto PIXEL_SIZE = size_t(4);
+
+// Creates an RGBA image with all channels of all pixels set to value
+graphics::Image createImage(
+	size_t width,
+	size_t height,
+	std::uint8_t value,
+	graphics::PixelFormat pixelFormat = graphics::FORMAT_R8G8B8A8_UNORM
+	)
+{
+	return graphics::Image(
+		std::vector<std::uint8_t>(width * height * PIXEL_SIZE, value),
+		graphics::Image::Dimensions(width, height),
+		1u,
+		1u,
+		pixelFormat
+		);
+}
+
+// Returns the first channel of the atlas texel containing textureCoordinates
+std::uint8_t texelAt(const TextureAtlas& atlas, const math::Vec2& textureCoordinates) {
+	const auto [width, height] = atlas.image().size();
+	const auto x = static_cast<size_t>(textureCoordinates.x() * static_cast<float>(width));
+	const auto y = static_cast<size_t>(textureCoordinates.y() * static_cast<float>(height));
+	return atlas.image().pixels().data()[(y * width + x) * PIXEL_SIZE];
+}
+
+BOOST_AUTO_TEST_SUITE(RendererTextureAtlasTestSuite);
+
+BOOST_AUTO_TEST_CASE(CopiesImagesIntoTheirRegions) {
+	auto images = std::vector<graphics::Image>();
+	images.emplace_back(createImage(3u, 5u, 1u));
+	images.emplace_back(createImage(7u, 2u, 2u));
+	images.emplace_back(createImage(4u, 4u, 3u));
+
+	const auto atlas = TextureAtlas::build(images);
+
+	BOOST_CHECK_EQUAL(atlas.image().size().first, 16u);
+	BOOST_CHECK_EQUAL(atlas.image().size().second, 16u);
+	BOOST_REQUIRE_EQUAL(atlas.regions().size(), images.size());
+
+	for (auto imageIdx = size_t(0); imageIdx < images.size(); ++imageIdx) {
+		const auto& region = atlas.region(imageIdx);
+		const auto expectedValue = static_cast<std::uint8_t>(imageIdx + 1u);
+
+		BOOST_CHECK_CLOSE(region.size.x() * 16.0f, static_cast<float>(images[imageIdx].size().first), 0.001f);
+		BOOST_CHECK_CLOSE(region.size.y() * 16.0f, static_cast<float>(images[imageIdx].size().second), 0.001f);
+
+		BOOST_CHECK_EQUAL(texelAt(atlas, region.map(math::Vec2(0.0f, 0.0f))), expectedValue);
+		BOOST_CHECK_EQUAL(texelAt(atlas, region.map(math::Vec2(0.99f, 0.99f))), expectedValue);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GrowsToFitImages) {
+	auto images = std::vector<graphics::Image>(20u, createImage(16u, 16u, 1u));
+
+	const auto atlas = TextureAtlas::build(images, 256u, 0u);
+
+	BOOST_CHECK_EQUAL(atlas.image().size().first, 128u);
+	BOOST_CHECK_GT(atlas.occupancy(), 0.3f);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsIfImagesDontFit) {
+	auto images = std::vector<graphics::Image>(5u, createImage(16u, 16u, 1u));
+
+	BOOST_CHECK_THROW(TextureAtlas::build(images, 32u, 0u), exceptions::RuntimeError);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsIfPixelFormatsDiffer) {
+	auto images = std::vector<graphics::Image>();
+	images.emplace_back(createImage(4u, 4u, 1u));
+	images.emplace_back(createImage(4u, 4u, 1u, graphics::FORMAT_R8G8B8A8_UNORM_SRGB));
+
+	BOOST_CHECK_THROW(TextureAtlas::build(images), exceptions::LogicError);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererTextureAtlasTestSuite */);
+
+} // anonymous namespace
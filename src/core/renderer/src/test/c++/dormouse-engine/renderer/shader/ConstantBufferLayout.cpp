@@ -0,0 +1,114 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+#include "dormouse-engine/renderer/shader/ConstantBufferLayout.hpp"
+#include "dormouse-engine/renderer/shader/Property.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+struct Value {
+	float value;
+};
+
+void writeShaderData(const Value& value, essentials::BufferView buffer, graphics::ShaderDataType /*dataType*/) {
+	std::memcpy(buffer.data(), &value.value, sizeof(value.value));
+}
+
+// Property with named children, counting how many times they are retrieved
+struct Node {
+	std::unordered_map<essentials::StringId, std::vector<Property>> children;
+	size_t* getCount;
+};
+
+bool hasShaderProperty(const Node& node, essentials::StringId id, size_t arrayIdx) {
+	auto it = node.children.find(id);
+	return it != node.children.end() && arrayIdx < it->second.size();
+}
+
+Property getShaderProperty(const Node& node, essentials::StringId id, size_t arrayIdx) {
+	++*node.getCount;
+	return node.children.at(id)[arrayIdx];
+}
+
+graphics::ShaderDataType floatType() {
+	return graphics::ShaderDataType(
+		graphics::ShaderDataType::Class::SCALAR, graphics::ShaderDataType::ScalarType::FLOAT, 1u, 1u);
+}
+
+using Object = PropertyDescriptor::Object;
+
+Parameter parameter(PropertyDescriptor::Objects objects, size_t offset) {
+	return Parameter(PropertyDescriptor(std::move(objects)), floatType(), offset);
+}
+
+BOOST_AUTO_TEST_SUITE(RendererShaderConstantBufferLayoutTestSuite);
+
+BOOST_AUTO_TEST_CASE(ResolvesSharedPropertiesOnce) {
+	auto getCount = size_t(0);
+
+	auto object = Node{ {}, &getCount };
+	object.children["a"].emplace_back(Value{ 1.0f });
+	object.children["b"].emplace_back(Value{ 2.0f });
+
+	auto root = Node{ {}, &getCount };
+	root.children["object"].emplace_back(&object);
+
+	const auto layout = ConstantBufferLayout({
+		parameter({ Object("object"), Object("a") }, 0u),
+		parameter({ Object("object"), Object("b") }, 4u),
+		});
+
+	auto buffer = std::array<float, 2>();
+	layout.write(essentials::viewBuffer(buffer), Property(&root));
+
+	BOOST_CHECK_EQUAL(buffer[0], 1.0f);
+	BOOST_CHECK_EQUAL(buffer[1], 2.0f);
+	BOOST_CHECK_EQUAL(getCount, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(UnrollsArrays) {
+	auto getCount = size_t(0);
+
+	auto root = Node{ {}, &getCount };
+	root.children["values"] = { Value{ 1.0f }, Value{ 2.0f }, Value{ 3.0f } };
+
+	const auto layout = ConstantBufferLayout({
+		parameter({ Object("values", 3u, 8u) }, 4u),
+		});
+
+	BOOST_CHECK_EQUAL(layout.operations().size(), 6u);
+
+	auto buffer = std::array<float, 7>();
+	layout.write(essentials::viewBuffer(buffer), Property(&root));
+
+	BOOST_CHECK_EQUAL(buffer[1], 1.0f);
+	BOOST_CHECK_EQUAL(buffer[3], 2.0f);
+	BOOST_CHECK_EQUAL(buffer[5], 3.0f);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsIfPropertyNotBound) {
+	auto getCount = size_t(0);
+
+	auto root = Node{ {}, &getCount };
+	root.children["a"].emplace_back(Value{ 1.0f });
+
+	const auto layout = ConstantBufferLayout({
+		parameter({ Object("a") }, 0u),
+		parameter({ Object("b") }, 4u),
+		});
+
+	auto buffer = std::array<float, 2>();
+	BOOST_CHECK_THROW(layout.write(essentials::viewBuffer(buffer), Property(&root)), PropertyNotBound);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererShaderConstantBufferLayoutTestSuite */);
+
+} // anonymous namespace
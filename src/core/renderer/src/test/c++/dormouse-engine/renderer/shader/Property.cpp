@@ -0,0 +1,110 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#pragma warning(push, 3)
+#	include <ponder/classbuilder.hpp>
+#pragma warning(pop)
+
+#include <array>
+#include <cstdint>
+
+#include "dormouse-engine/essentials/observer_ptr.hpp"
+#include "dormouse-engine/reflection/Object.hpp"
+#include "dormouse-engine/renderer/shader/Property.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace property_test_detail {
+
+struct Inner {
+	float value;
+};
+
+struct Outer {
+	float value;
+	Inner inner;
+};
+
+void declareInner() {
+	ponder::Class::declare<Inner>("property_test_detail::Inner")
+		.property("value", &Inner::value)
+		;
+}
+
+void declareOuter() {
+	ponder::Class::declare<Outer>("property_test_detail::Outer")
+		.property("value", &Outer::value)
+		.property("inner", &Outer::inner)
+		;
+}
+
+} // namespace property_test_detail
+
+PONDER_AUTO_TYPE(property_test_detail::Inner, &property_test_detail::declareInner);
+PONDER_AUTO_TYPE(property_test_detail::Outer, &property_test_detail::declareOuter);
+
+namespace /* anonymous */ {
+
+graphics::ShaderDataType dataType(graphics::ShaderDataType::ScalarType scalarType, size_t columns) {
+	return graphics::ShaderDataType(
+		columns == 1u ? graphics::ShaderDataType::Class::SCALAR : graphics::ShaderDataType::Class::VECTOR,
+		scalarType,
+		columns,
+		1u
+		);
+}
+
+BOOST_AUTO_TEST_SUITE(RendererShaderPropertyTestSuite);
+
+BOOST_AUTO_TEST_CASE(ResolvesReflectedPropertiesPerClass) {
+	auto outer = property_test_detail::Outer{ 1.0f, { 2.0f } };
+	const auto outerObject = reflection::Object(essentials::make_observer(&outer));
+
+	for (auto repeat = 0; repeat < 2; ++repeat) {
+		BOOST_CHECK(hasShaderProperty(outerObject, "value", 0u));
+		BOOST_CHECK(hasShaderProperty(outerObject, "inner", 0u));
+		BOOST_CHECK(!hasShaderProperty(outerObject, "missing", 0u));
+	}
+
+	const auto inner = getShaderProperty(outerObject, "inner", 0u);
+
+	BOOST_CHECK(inner.has("value"));
+	BOOST_CHECK(!inner.has("inner"));
+}
+
+BOOST_AUTO_TEST_CASE(WritesBuiltInTypesDirectly) {
+	auto floats = std::array<float, 4>();
+	Property(math::Vec4(1.0f, 2.0f, 3.0f, 4.0f))
+		.write(essentials::viewBuffer(floats), dataType(graphics::ShaderDataType::ScalarType::FLOAT, 4u));
+
+	BOOST_CHECK_EQUAL(floats[0], 1.0f);
+	BOOST_CHECK_EQUAL(floats[3], 4.0f);
+
+	auto ints = std::array<std::int32_t, 1>();
+	Property(2.5f).write(essentials::viewBuffer(ints), dataType(graphics::ShaderDataType::ScalarType::INT, 1u));
+
+	BOOST_CHECK_EQUAL(ints[0], 2);
+
+	BOOST_CHECK_THROW(
+		Property(math::Vec2(1.0f, 2.0f))
+			.write(essentials::viewBuffer(ints), dataType(graphics::ShaderDataType::ScalarType::INT, 2u)),
+		IncompatibleDataType
+		);
+}
+
+BOOST_AUTO_TEST_CASE(WritesReflectedScalars) {
+	auto outer = property_test_detail::Outer{ 1.0f, { 2.0f } };
+	const auto outerObject = reflection::Object(essentials::make_observer(&outer));
+
+	auto floats = std::array<float, 1>();
+	getShaderProperty(outerObject, "value", 0u)
+		.write(essentials::viewBuffer(floats), dataType(graphics::ShaderDataType::ScalarType::FLOAT, 1u));
+
+	BOOST_CHECK_EQUAL(floats[0], 1.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererShaderPropertyTestSuite */);
+
+} // anonymous namespace
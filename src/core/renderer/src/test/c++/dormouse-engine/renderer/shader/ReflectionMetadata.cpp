@@ -0,0 +1,145 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <fstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "dormouse-engine/renderer/shader/ReflectionMetadata.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+graphics::ShaderReflection::Type scalarType(const std::string& name, size_t offset) {
+	auto type = graphics::ShaderReflection::Type();
+	type.name = name;
+	type.offset = offset;
+	type.dataType = graphics::ShaderDataType(
+		graphics::ShaderDataType::Class::SCALAR, graphics::ShaderDataType::ScalarType::FLOAT, 1u, 1u);
+	type.elements = 0u;
+	type.elementOffset = 4u;
+	return type;
+}
+
+graphics::ShaderReflection createReflection() {
+	auto inputParameter = graphics::ShaderReflection::InputParameterInfo();
+	inputParameter.semantic = "POSITION";
+	inputParameter.semanticIndex = 0u;
+	inputParameter.dataType = graphics::ShaderReflection::InputParameterInfo::DataType::FLOAT;
+	inputParameter.elements = 3u;
+
+	auto lightType = graphics::ShaderReflection::Type();
+	lightType.name = "Light";
+	lightType.offset = 0u;
+	lightType.dataType = graphics::ShaderDataType(
+		graphics::ShaderDataType::Class::STRUCT, graphics::ShaderDataType::ScalarType::EMPTY, 2u, 1u);
+	lightType.elements = 4u;
+	lightType.elementOffset = 16u;
+	lightType.members.emplace_back("intensity", scalarType("float", 0u));
+	lightType.members.emplace_back("range", scalarType("float", 4u));
+
+	auto variable = graphics::ShaderReflection::Variable();
+	variable.name = "scene_lights";
+	variable.offset = 16u;
+	variable.size = 64u;
+	variable.type = lightType;
+
+	auto constantBuffer = graphics::ShaderReflection::ConstantBufferInfo();
+	constantBuffer.name = "SceneData";
+	constantBuffer.size = 80u;
+	constantBuffer.slot = 1u;
+	constantBuffer.variables.emplace_back(variable);
+
+	auto resource = graphics::ShaderReflection::ResourceInfo();
+	resource.type = graphics::ShaderReflection::ResourceInfo::Type::TEXTURE;
+	resource.name = "sprite_texture";
+	resource.slot = 2u;
+	resource.dimension = graphics::ShaderReflection::ResourceInfo::Dimension::TEXTURE2D;
+
+	return graphics::ShaderReflection({ inputParameter }, { constantBuffer }, { resource });
+}
+
+void checkReflection(const graphics::ShaderReflection& reflection) {
+	BOOST_REQUIRE_EQUAL(reflection.inputParameters().size(), 1u);
+	BOOST_CHECK_EQUAL(reflection.inputParameters()[0].semantic, "POSITION");
+	BOOST_CHECK_EQUAL(reflection.inputParameters()[0].elements, 3u);
+
+	BOOST_REQUIRE_EQUAL(reflection.constantBuffers().size(), 1u);
+	const auto& constantBuffer = reflection.constantBuffers()[0];
+	BOOST_CHECK_EQUAL(constantBuffer.name, "SceneData");
+	BOOST_CHECK_EQUAL(constantBuffer.size, 80u);
+	BOOST_CHECK_EQUAL(constantBuffer.slot, 1u);
+
+	BOOST_REQUIRE_EQUAL(constantBuffer.variables.size(), 1u);
+	const auto& variable = constantBuffer.variables[0];
+	BOOST_CHECK_EQUAL(variable.name, "scene_lights");
+	BOOST_CHECK_EQUAL(variable.offset, 16u);
+	BOOST_CHECK_EQUAL(variable.size, 64u);
+	BOOST_CHECK_EQUAL(variable.type.name, "Light");
+	BOOST_CHECK(variable.type.dataType.klass == graphics::ShaderDataType::Class::STRUCT);
+	BOOST_CHECK_EQUAL(variable.type.elements, 4u);
+	BOOST_CHECK_EQUAL(variable.type.elementOffset, 16u);
+
+	BOOST_REQUIRE_EQUAL(variable.type.members.size(), 2u);
+	const auto& range = variable.type.members[1];
+	BOOST_CHECK_EQUAL(std::get<graphics::ShaderReflection::Type::MemberNameTag>(range), "range");
+	BOOST_CHECK_EQUAL(std::get<graphics::ShaderReflection::Type::MemberTypeTag>(range).offset, 4u);
+	BOOST_CHECK(
+		std::get<graphics::ShaderReflection::Type::MemberTypeTag>(range).dataType.scalarType ==
+			graphics::ShaderDataType::ScalarType::FLOAT
+		);
+
+	BOOST_REQUIRE_EQUAL(reflection.resources().size(), 1u);
+	BOOST_CHECK_EQUAL(reflection.resources()[0].name, "sprite_texture");
+	BOOST_CHECK_EQUAL(reflection.resources()[0].slot, 2u);
+	BOOST_CHECK(
+		reflection.resources()[0].dimension == graphics::ShaderReflection::ResourceInfo::Dimension::TEXTURE2D);
+}
+
+BOOST_AUTO_TEST_SUITE(RendererShaderReflectionMetadataTestSuite);
+
+BOOST_AUTO_TEST_CASE(ReadsSerialisedReflection) {
+	const auto metadata = ReflectionMetadata(ReflectionMetadata::serialise(createReflection(), 42u));
+
+	BOOST_CHECK_EQUAL(metadata.bytecodeHash(), 42u);
+	checkReflection(metadata.reflection());
+}
+
+BOOST_AUTO_TEST_CASE(ReadsMappedFile) {
+	const auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	const auto data = ReflectionMetadata::serialise(createReflection(), 42u);
+
+	{
+		auto os = std::ofstream(path.string(), std::ios::binary);
+		os.write(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+
+	{
+		const auto metadata = ReflectionMetadata::map(path);
+		checkReflection(metadata.reflection());
+	}
+
+	boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(RejectsInvalidData) {
+	auto data = ReflectionMetadata::serialise(createReflection(), 42u);
+
+	auto truncated = data;
+	truncated.pop_back();
+	BOOST_CHECK_THROW(ReflectionMetadata(std::move(truncated)), InvalidReflectionMetadata);
+
+	auto wrongMagic = data;
+	wrongMagic[0] ^= 0xff;
+	BOOST_CHECK_THROW(ReflectionMetadata(std::move(wrongMagic)), InvalidReflectionMetadata);
+
+	BOOST_CHECK_THROW(ReflectionMetadata(essentials::ByteVector(4u)), InvalidReflectionMetadata);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererShaderReflectionMetadataTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,173 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "dormouse-engine/essentials/ThreadPool.hpp"
+#include "dormouse-engine/essentials/hash-bytes.hpp"
+#include "dormouse-engine/renderer/shader/ShaderCache.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+const auto SHADER_CODE = std::string(
+	"float4 vs(float4 position : POSITION) : SV_POSITION { return position; }\n"
+	"float4 ps() : SV_TARGET { return float4(1.0f, 0.0f, 0.0f, 1.0f); }\n"
+	);
+
+const auto INCLUDING_SHADER_CODE = std::string(
+	"#include \"colour.hlsl\"\n"
+	"float4 ps() : SV_TARGET { return COLOUR; }\n"
+	);
+
+class TmpDir {
+public:
+
+	TmpDir() :
+		path_(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path())
+	{
+	}
+
+	~TmpDir() {
+		boost::filesystem::remove_all(path_);
+	}
+
+	const boost::filesystem::path& path() const {
+		return path_;
+	}
+
+private:
+
+	boost::filesystem::path path_;
+
+};
+
+BOOST_AUTO_TEST_SUITE(RendererShaderShaderCacheTestSuite);
+
+BOOST_AUTO_TEST_CASE(CompilesEachShaderOnce) {
+	auto shaderCache = ShaderCache();
+	const auto code = essentials::viewBuffer(SHADER_CODE);
+
+	const auto first = shaderCache.compile(code, "test", "vs", graphics::ShaderType::VERTEX);
+	const auto second = shaderCache.compile(code, "test", "vs", graphics::ShaderType::VERTEX);
+	shaderCache.compile(code, "test", "ps", graphics::ShaderType::PIXEL);
+
+	BOOST_CHECK_EQUAL(first, second);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 2u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().memoryHits, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ReusesShadersStoredOnDisk) {
+	const auto tmpDir = TmpDir();
+	const auto code = essentials::viewBuffer(SHADER_CODE);
+
+	auto compiled = ShaderCache::Bytecode();
+	{
+		auto shaderCache = ShaderCache(tmpDir.path());
+		compiled = shaderCache.compile(code, "test", "vs", graphics::ShaderType::VERTEX);
+	}
+
+	auto shaderCache = ShaderCache(tmpDir.path());
+	const auto loaded = shaderCache.compile(code, "test", "vs", graphics::ShaderType::VERTEX);
+
+	BOOST_CHECK(*compiled == *loaded);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().diskHits, 1u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ReusesReflectionMetadataStoredOnDisk) {
+	const auto tmpDir = TmpDir();
+	const auto code = essentials::viewBuffer(SHADER_CODE);
+	const auto compilation = ShaderCache::Compilation{
+		code, "test", "vs", graphics::ShaderType::VERTEX, ShaderCache::IncludeHandler(), ShaderCache::CompilerFlags() };
+
+	{
+		auto shaderCache = ShaderCache(tmpDir.path());
+		shaderCache.compile(compilation);
+		BOOST_CHECK_EQUAL(shaderCache.statistics().reflections, 1u);
+	}
+
+	auto shaderCache = ShaderCache(tmpDir.path());
+	const auto compiled = shaderCache.compileReflected(compilation);
+
+	BOOST_REQUIRE(compiled.metadata);
+	BOOST_CHECK_EQUAL(
+		compiled.metadata->bytecodeHash(),
+		essentials::hashBytes(compiled.bytecode->data(), compiled.bytecode->size())
+		);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().diskHits, 1u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().reflections, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ReflectsAgainIfMetadataIsMissing) {
+	const auto tmpDir = TmpDir();
+	const auto code = essentials::viewBuffer(SHADER_CODE);
+
+	{
+		auto shaderCache = ShaderCache(tmpDir.path());
+		shaderCache.compile(code, "test", "vs", graphics::ShaderType::VERTEX);
+	}
+
+	for (const auto& file : boost::filesystem::directory_iterator(tmpDir.path())) {
+		if (file.path().extension() == ".dsr") {
+			boost::filesystem::remove(file.path());
+		}
+	}
+
+	auto shaderCache = ShaderCache(tmpDir.path());
+	const auto compiled = shaderCache.compileReflected(ShaderCache::Compilation{
+		code, "test", "vs", graphics::ShaderType::VERTEX, ShaderCache::IncludeHandler(), ShaderCache::CompilerFlags() });
+
+	BOOST_CHECK(compiled.metadata);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().diskHits, 1u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().reflections, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(RecompilesIfIncludedContentChanges) {
+	const auto tmpDir = TmpDir();
+
+	auto colour = std::string("#define COLOUR float4(1.0f, 0.0f, 0.0f, 1.0f)\n");
+	auto includeHandler = [&colour](const std::string& /* name */) {
+			return std::make_shared<essentials::ByteVector>(colour.begin(), colour.end());
+		};
+
+	const auto code = essentials::viewBuffer(INCLUDING_SHADER_CODE);
+
+	auto shaderCache = ShaderCache(tmpDir.path());
+	shaderCache.compile(code, "test", "ps", graphics::ShaderType::PIXEL, includeHandler);
+	shaderCache.compile(code, "test", "ps", graphics::ShaderType::PIXEL, includeHandler);
+
+	colour = "#define COLOUR float4(0.0f, 1.0f, 0.0f, 1.0f)\n";
+	shaderCache.compile(code, "test", "ps", graphics::ShaderType::PIXEL, includeHandler);
+
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 2u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().memoryHits, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(WarmUpFillsTheCache) {
+	auto shaderCache = ShaderCache();
+
+	const auto code = essentials::viewBuffer(SHADER_CODE);
+	const auto vertexShaderCompilation = ShaderCache::Compilation{
+		code, "test", "vs", graphics::ShaderType::VERTEX, ShaderCache::IncludeHandler(), ShaderCache::CompilerFlags() };
+	const auto pixelShaderCompilation = ShaderCache::Compilation{
+		code, "test", "ps", graphics::ShaderType::PIXEL, ShaderCache::IncludeHandler(), ShaderCache::CompilerFlags() };
+
+	auto threadPool = essentials::ThreadPool(2u);
+	shaderCache.warmUp({ vertexShaderCompilation, pixelShaderCompilation }, threadPool);
+	shaderCache.compile(vertexShaderCompilation);
+	shaderCache.compile(pixelShaderCompilation);
+
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 2u);
+	BOOST_CHECK_EQUAL(shaderCache.statistics().memoryHits, 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererShaderShaderCacheTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,30 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include "dormouse-engine/renderer/shader/Technique.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(TechniqueTestSuite);
+
+BOOST_AUTO_TEST_CASE(TracksActiveStages) {
+	auto technique = Technique();
+	BOOST_CHECK(technique.activeStages() == 0u);
+
+	technique.setShader(VertexShader());
+	technique.setShader(PixelShader());
+
+	BOOST_CHECK(technique.active(graphics::ShaderType::VERTEX));
+	BOOST_CHECK(!technique.active(graphics::ShaderType::GEOMETRY));
+	BOOST_CHECK(!technique.active(graphics::ShaderType::HULL));
+	BOOST_CHECK(!technique.active(graphics::ShaderType::DOMAIN));
+	BOOST_CHECK(technique.active(graphics::ShaderType::PIXEL));
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* TechniqueTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,74 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+#include "dormouse-engine/tester/RenderingFixture.hpp"
+#include "dormouse-engine/renderer/shader/TechniqueCompiler.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::renderer;
+using namespace dormouse_engine::renderer::shader;
+
+namespace /* anonymous */ {
+
+const auto SHADER_CODE = std::string(
+	"float4 vs(float4 position : POSITION) : SV_POSITION { return position; }\n"
+	"float4 ps() : SV_TARGET { return float4(1.0f, 0.0f, 0.0f, 1.0f); }\n"
+	);
+
+TechniqueCompiler::Description description(const std::string& pixelShaderEntrypoint = "ps") {
+	auto result = TechniqueCompiler::Description();
+	result.code = essentials::viewBuffer(SHADER_CODE);
+	result.name = "test";
+	result.vertexShaderEntrypoint = "vs";
+	result.pixelShaderEntrypoint = pixelShaderEntrypoint;
+	return result;
+}
+
+BOOST_FIXTURE_TEST_SUITE(RendererShaderTechniqueCompilerTestSuite, tester::RenderingFixture);
+
+BOOST_AUTO_TEST_CASE(CompilesTechniquesInParallel) {
+	auto shaderCache = ShaderCache();
+	auto threadPool = essentials::ThreadPool(4u);
+	auto techniqueCompiler = TechniqueCompiler(graphicsDevice(), shaderCache, threadPool);
+
+	auto techniques = std::vector<std::future<Technique>>();
+	for (auto idx = 0; idx < 8; ++idx) {
+		techniques.emplace_back(techniqueCompiler.compile(description()));
+	}
+
+	for (auto& technique : techniques) {
+		technique.get();
+	}
+
+	const auto statistics = shaderCache.statistics();
+	BOOST_CHECK_EQUAL(statistics.memoryHits + statistics.compilations, 16u);
+	BOOST_CHECK_GE(statistics.compilations, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(RethrowsCompilationErrors) {
+	auto shaderCache = ShaderCache();
+	auto threadPool = essentials::ThreadPool(2u);
+	auto techniqueCompiler = TechniqueCompiler(graphicsDevice(), shaderCache, threadPool);
+
+	auto technique = techniqueCompiler.compile(description("missing"));
+
+	BOOST_CHECK_THROW(technique.get(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(CompilesOnCallingThreadWithoutThreadPool) {
+	auto shaderCache = ShaderCache();
+	auto techniqueCompiler = TechniqueCompiler(graphicsDevice(), shaderCache);
+
+	auto technique = techniqueCompiler.compile(description());
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 0u);
+
+	technique.get();
+	BOOST_CHECK_EQUAL(shaderCache.statistics().compilations, 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* RendererShaderTechniqueCompilerTestSuite */);
+
+} // anonymous namespace
@@ -1,5 +1,11 @@
 structure.library_project("tester", function()
 		includedirs(ponder_include_dir())
-		links { "wm", "engine" }
+		if GRAPHICS_API == "null" then
+			-- No window, so rendering tests run wherever graphics-null builds
+			removefiles { "**/WindowedFixture.*" }
+			links { "renderer" }
+		else
+			links { "wm", "engine" }
+		end
 	end
 	)
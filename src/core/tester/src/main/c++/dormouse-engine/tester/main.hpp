@@ -1,14 +1,21 @@
 #ifndef _DORMOUSEENGINE_TESTER_MAIN_HPP_
 #define _DORMOUSEENGINE_TESTER_MAIN_HPP_
 
-#define BOOST_TEST_NO_MAIN
-
 #ifdef DE_TEST_MODULE
 #	define BOOST_TEST_MODULE DE_TEST_MODULE
 #else
 #	error "DE_TEST_MODULE not defined""
 #endif /* DE_TEST_MODULE */
 
+#if defined(DE_GRAPHICS_NULL)
+
+// The headless rendering fixture needs neither an app nor a window, so Boost.Test's own main is used
+#include <boost/test/included/unit_test.hpp>
+
+#else
+
+#define BOOST_TEST_NO_MAIN
+
 #include <iostream>
 
 #include "dormouse-engine/system/platform.hpp"
@@ -74,4 +81,6 @@ DE_APP_MAIN()
 	return boost::unit_test::unit_test_main(&initUnitTest, __argc, __argv);
 }
 
+#endif /* DE_GRAPHICS_NULL */
+
 #endif /* _DORMOUSEENGINE_TESTER_MAIN_HPP_ */
@@ -0,0 +1,103 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dormouse-engine/essentials/Range.hpp"
+#include "dormouse-engine/essentials/StringId.hpp"
+#include "dormouse-engine/essentials/test-utils/Benchmark.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::essentials;
+
+namespace /* anonymous */ {
+
+const auto THREAD_COUNT = size_t(8);
+
+const auto STRING_COUNT = size_t(20000);
+
+const auto ITERATION_COUNT = size_t(20);
+
+// Names shared by all threads, as when many threads name the same shader properties
+std::vector<std::string> createNames() {
+	auto names = std::vector<std::string>();
+	names.reserve(STRING_COUNT);
+
+	for (const auto idx : IndexRange(0u, STRING_COUNT)) {
+		names.emplace_back("property_" + std::to_string(idx));
+	}
+
+	return names;
+}
+
+template <class Func>
+void runOnThreads(Func func) {
+	auto threads = std::vector<std::thread>();
+	threads.reserve(THREAD_COUNT);
+
+	for (const auto threadIdx : IndexRange(0u, THREAD_COUNT)) {
+		threads.emplace_back(func, threadIdx);
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(StringIdBenchmarkSuite);
+
+BOOST_AUTO_TEST_CASE(ConcurrentInterning) {
+	const auto names = createNames();
+
+	test_utils::benchmark(
+		"Strings, " + std::to_string(THREAD_COUNT) + " threads adding the same new strings",
+		ITERATION_COUNT,
+		[]() {
+			Strings::setInstance(std::make_unique<Strings>());
+		},
+		[&names]() {
+			auto strings = Strings::instance();
+			runOnThreads([&strings, &names](size_t threadIdx) {
+					// each thread starts at a different offset, so that they contend for shards
+					for (const auto idx : IndexRange(0u, STRING_COUNT)) {
+						strings->add(names[(idx + threadIdx * STRING_COUNT / THREAD_COUNT) % STRING_COUNT]);
+					}
+				});
+		}
+		);
+
+	Strings::setInstance(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentLookups) {
+	const auto names = createNames();
+
+	Strings::setInstance(std::make_unique<Strings>());
+	auto strings = Strings::instance();
+	for (const auto& name : names) {
+		strings->add(name);
+	}
+
+	test_utils::benchmark(
+		"Strings, " + std::to_string(THREAD_COUNT) + " threads looking up interned strings",
+		ITERATION_COUNT,
+		[&strings, &names]() {
+			runOnThreads([&strings, &names](size_t threadIdx) {
+					for (const auto idx : IndexRange(0u, STRING_COUNT)) {
+						strings->add(names[(idx + threadIdx * STRING_COUNT / THREAD_COUNT) % STRING_COUNT]);
+					}
+				});
+		}
+		);
+
+	BOOST_CHECK_EQUAL(strings->size(), STRING_COUNT);
+
+	Strings::setInstance(nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* StringIdBenchmarkSuite */);
+
+} // anonymous namespace
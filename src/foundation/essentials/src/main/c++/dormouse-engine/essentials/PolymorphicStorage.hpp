@@ -1,6 +1,10 @@
 #ifndef _DORMOUSEENGINE_ESSENTIALS_POLYMORPHICSTORAGE_HPP_
 #define _DORMOUSEENGINE_ESSENTIALS_POLYMORPHICSTORAGE_HPP_
 
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
 #include <utility>
 #include <type_traits>
 
@@ -11,63 +15,84 @@ public:
 
 	virtual ~ConceptBase() = default;
 
-	virtual void copy(void* where) const = 0;
-
-	virtual void move(void* where) = 0;
-
 };
 
+// Base of models kept in a PolymorphicStorage. Models mustn't add any state of their own, which
+// PolymorphicStorage checks - a model whose StoredType is trivially copyable is copied, moved and destroyed
+// as raw bytes.
 template <class ConceptType, class ModelType, class StoredType>
 class ModelBase : public ConceptType {
 public:
 
+	using Stored = StoredType;
+
 	ModelBase(StoredType model) :
 		model_(std::move(model))
 	{
 	}
 
-	void copy(void* where) const override final {
-		new(where) ModelType(model_);
-	}
-
-	void move(void* where) override final {
-		new(where) ModelType(std::move(model_));
-	}
-
 protected:
 
 	StoredType model_;
 
 };
 
+// Value-semantic holder of a ModelType<T> accessed through ConceptType. Models which fit in SIZE bytes with
+// ALIGNMENT are kept in place, others on the heap.
+// Copying, moving and destroying go through a table of functions per model type rather than through virtual
+// functions, and are skipped in favour of memcpy for models storing trivially copyable types.
+// Caveat: models have virtual functions, so they are never trivially copyable and copying their bytes is
+// formally undefined behaviour. It works with Visual C++, GCC and Clang, where such a model is just its virtual
+// function table pointer followed by the stored value. The constructor asserts that the model adds no state to
+// ModelBase, and only models storing trivially copyable and destructible types are copied this way.
+// A moved-from storage holds no model, it may only be destroyed or assigned to.
 template <class ConceptType, template<class> class ModelType, size_t SIZE, size_t ALIGNMENT>
 class PolymorphicStorage final {
 public:
 
 	template <class T>
-	PolymorphicStorage(T model) {
-		static_assert(sizeof(ModelType<T>) <= SIZE);
-		static_assert(alignof(ModelType<T>) <= ALIGNMENT);
-
-		new(&storage_) ModelType<T>(std::move(model));
+	PolymorphicStorage(T model) :
+		operations_(&OPERATIONS<ModelType<T>>)
+	{
+		using Model = ModelType<T>;
+
+		static_assert(std::is_base_of_v<ModelBase<ConceptType, Model, typename Model::Stored>, Model>);
+		static_assert(
+			sizeof(Model) == sizeof(ModelBase<ConceptType, Model, typename Model::Stored>),
+			"Models mustn't add state to ModelBase"
+			);
+
+		if constexpr (STORED_INLINE<Model>) {
+			concept_ = new(&storage_) Model(std::move(model));
+		} else {
+			concept_ = new Model(std::move(model));
+		}
 	}
 
 	~PolymorphicStorage() noexcept {
-		get()->~ConceptType();
+		destroy_();
 	}
 
 	PolymorphicStorage(const PolymorphicStorage& other) {
-		other->copy(&storage_);
+		copyFrom_(other);
 	}
 
+	// other may only be destroyed or assigned to afterwards
 	PolymorphicStorage(PolymorphicStorage&& other) {
-		other->move(&storage_);
+		moveFrom_(other);
 	}
 
 	PolymorphicStorage& operator=(const PolymorphicStorage& other) {
 		if (this != &other) {
-			get()->~ConceptType();
-			other->copy(&storage_);
+			if (other.operations_->copy == nullptr) {
+				destroy_();
+				copyFrom_(other);
+			} else {
+				// copying may throw, so it's done before this is destroyed
+				auto copy = other;
+				destroy_();
+				moveFrom_(copy);
+			}
 		}
 
 		return *this;
@@ -75,19 +100,25 @@ public:
 
 	PolymorphicStorage& operator=(PolymorphicStorage&& other) {
 		if (this != &other) {
-			get()->~ConceptType();
-			other->move(&storage_);
+			destroy_();
+			moveFrom_(other);
 		}
 
 		return *this;
 	}
 
+	bool onHeap() const noexcept {
+		return operations_->heap;
+	}
+
 	const ConceptType* get() const noexcept {
-		return reinterpret_cast<const ConceptType*>(&storage_);
+		assert(concept_ != nullptr && "PolymorphicStorage used after being moved from");
+		return concept_;
 	}
 
 	ConceptType* get() noexcept {
-		return const_cast<ConceptType*>(const_cast<const PolymorphicStorage&>(*this).get());
+		assert(concept_ != nullptr && "PolymorphicStorage used after being moved from");
+		return concept_;
 	}
 
 	const ConceptType* operator->() const {
@@ -108,8 +139,120 @@ public:
 
 private:
 
+	// Functions are null where the storage bytes are copied instead, for heap models that means the pointer
+	struct Operations {
+
+		ConceptType* (*copy)(const ConceptType& source, void* storage);
+
+		ConceptType* (*move)(ConceptType& source, void* storage);
+
+		void (*destroy)(ConceptType& model) noexcept;
+
+		bool heap;
+
+	};
+
+	template <class Model>
+	static constexpr auto STORED_INLINE = sizeof(Model) <= SIZE && alignof(Model) <= ALIGNMENT;
+
+	template <class Model>
+	static constexpr auto TRIVIALLY_RELOCATABLE =
+		STORED_INLINE<Model> &&
+		std::is_trivially_copyable_v<typename Model::Stored> &&
+		std::is_trivially_destructible_v<typename Model::Stored>;
+
+	template <class Model>
+	static ConceptType* copyInline_(const ConceptType& source, void* storage) {
+		return new(storage) Model(static_cast<const Model&>(source));
+	}
+
+	template <class Model>
+	static ConceptType* copyToHeap_(const ConceptType& source, [[maybe_unused]] void* storage) {
+		return new Model(static_cast<const Model&>(source));
+	}
+
+	template <class Model>
+	static ConceptType* moveInline_(ConceptType& source, void* storage) {
+		return new(storage) Model(std::move(static_cast<Model&>(source)));
+	}
+
+	template <class Model>
+	static void destroyInline_(ConceptType& model) noexcept {
+		static_cast<Model&>(model).~Model();
+	}
+
+	template <class Model>
+	static void destroyOnHeap_(ConceptType& model) noexcept {
+		delete &static_cast<Model&>(model);
+	}
+
+	template <class Model>
+	static constexpr Operations makeOperations_() noexcept {
+		if constexpr (TRIVIALLY_RELOCATABLE<Model>) {
+			return Operations{ nullptr, nullptr, nullptr, false };
+		} else if constexpr (STORED_INLINE<Model>) {
+			return Operations{ &copyInline_<Model>, &moveInline_<Model>, &destroyInline_<Model>, false };
+		} else {
+			return Operations{ &copyToHeap_<Model>, nullptr, &destroyOnHeap_<Model>, true };
+		}
+	}
+
+	template <class Model>
+	static constexpr Operations OPERATIONS = makeOperations_<Model>();
+
+	const Operations* operations_;
+
+	// Points into storage_ or to the heap allocated model, null after being moved from
+	ConceptType* concept_;
+
 	std::aligned_storage_t<SIZE, ALIGNMENT> storage_;
 
+	// Points to this storage's copy of the model other.concept_ points to in other.storage_
+	ConceptType* relocated_(const PolymorphicStorage& other) noexcept {
+		const auto offset =
+			reinterpret_cast<const std::byte*>(other.concept_) - reinterpret_cast<const std::byte*>(&other.storage_);
+		return reinterpret_cast<ConceptType*>(reinterpret_cast<std::byte*>(&storage_) + offset);
+	}
+
+	void copyFrom_(const PolymorphicStorage& other) {
+		assert(other.concept_ != nullptr);
+
+		if (other.operations_->copy == nullptr) {
+			std::memcpy(&storage_, &other.storage_, SIZE);
+			concept_ = relocated_(other);
+		} else {
+			concept_ = other.operations_->copy(*other.concept_, &storage_);
+		}
+
+		operations_ = other.operations_;
+	}
+
+	// Leaves other without a model, so that moved-from storages behave the same wherever the model was
+	void moveFrom_(PolymorphicStorage& other) {
+		assert(other.concept_ != nullptr);
+
+		operations_ = other.operations_;
+
+		if (operations_->heap) {
+			concept_ = std::exchange(other.concept_, nullptr);
+		} else if (operations_->move == nullptr) {
+			std::memcpy(&storage_, &other.storage_, SIZE);
+			concept_ = relocated_(other);
+			other.concept_ = nullptr;
+		} else {
+			concept_ = operations_->move(*other.concept_, &storage_);
+			other.destroy_();
+		}
+	}
+
+	void destroy_() noexcept {
+		if (concept_ != nullptr && operations_->destroy != nullptr) {
+			operations_->destroy(*concept_);
+		}
+
+		concept_ = nullptr;
+	}
+
 };
 
 } // namespace dormouse_engine::essentials
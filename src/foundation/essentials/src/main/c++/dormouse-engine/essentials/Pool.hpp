@@ -0,0 +1,297 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_POOL_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_POOL_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/operators.hpp>
+
+namespace dormouse_engine::essentials {
+
+// Storage of objects referred to by handles. Objects are kept in chunks of CHUNK_SIZE slots, so they never
+// move and iterating over them walks contiguous memory a chunk at a time. A new chunk is allocated only when
+// all slots are in use. Free slots are kept on an intrusive free list, so adding and erasing objects is
+// constant time and, once the pool has grown to its working size, doesn't allocate.
+// Each slot counts how many times it has been used. A handle records that generation along with the slot
+// index, so handles to erased objects are detected even if their slot has been reused since.
+template <class T, size_t CHUNK_SIZE = 256u>
+class Pool final {
+private:
+
+	struct Slot;
+
+public:
+
+	static_assert(CHUNK_SIZE > 0u);
+
+	struct Handle {
+
+		std::uint32_t index = 0u;
+
+		// Odd while the object is alive, a default constructed handle is never valid
+		std::uint32_t generation = 0u;
+
+		friend bool operator==(const Handle& lhs, const Handle& rhs) noexcept {
+			return lhs.index == rhs.index && lhs.generation == rhs.generation;
+		}
+
+		friend bool operator!=(const Handle& lhs, const Handle& rhs) noexcept {
+			return !(lhs == rhs);
+		}
+
+	};
+
+	// Visits live objects in slot order
+	template <class ValueType, class PoolType>
+	class Iterator : public boost::forward_iterator_helper<Iterator<ValueType, PoolType>, ValueType> {
+	public:
+
+		Iterator() = default;
+
+		ValueType& operator*() const {
+			return pool_->slot_(index_).object();
+		}
+
+		Iterator& operator++() {
+			++index_;
+			skipFree_();
+			return *this;
+		}
+
+		bool operator==(const Iterator& other) const {
+			return index_ == other.index_;
+		}
+
+		Handle handle() const noexcept {
+			return Handle{ static_cast<std::uint32_t>(index_), pool_->slot_(index_).generation };
+		}
+
+	private:
+
+		PoolType* pool_ = nullptr;
+
+		size_t index_ = 0u;
+
+		Iterator(PoolType* pool, size_t index) noexcept :
+			pool_(pool),
+			index_(index)
+		{
+			skipFree_();
+		}
+
+		void skipFree_() noexcept {
+			while (index_ != pool_->capacity() && !pool_->slot_(index_).alive()) {
+				++index_;
+			}
+		}
+
+		friend class Pool;
+
+	};
+
+	using iterator = Iterator<T, Pool>;
+
+	using const_iterator = Iterator<const T, const Pool>;
+
+	Pool() = default;
+
+	Pool(const Pool&) = delete;
+
+	// Handles to other's objects refer to the same objects in this pool
+	Pool(Pool&& other) noexcept :
+		chunks_(std::move(other.chunks_)),
+		size_(std::exchange(other.size_, 0u)),
+		firstFree_(std::exchange(other.firstFree_, NO_SLOT))
+	{
+		other.chunks_.clear();
+	}
+
+	~Pool() noexcept {
+		clear();
+	}
+
+	Pool& operator=(const Pool&) = delete;
+
+	Pool& operator=(Pool&& other) noexcept {
+		if (this != &other) {
+			clear();
+			chunks_ = std::move(other.chunks_);
+			other.chunks_.clear();
+			size_ = std::exchange(other.size_, 0u);
+			firstFree_ = std::exchange(other.firstFree_, NO_SLOT);
+		}
+
+		return *this;
+	}
+
+	template <class... Args>
+	Handle emplace(Args&&... args) {
+		if (firstFree_ == NO_SLOT) {
+			grow_();
+		}
+
+		auto& slot = slot_(firstFree_);
+		new(&slot.storage) T(std::forward<Args>(args)...);
+
+		const auto index = firstFree_;
+		firstFree_ = slot.nextFree;
+		++slot.generation;
+		++size_;
+
+		return Handle{ index, slot.generation };
+	}
+
+	// Does nothing if handle is stale
+	void erase(Handle handle) noexcept {
+		if (!contains(handle)) {
+			return;
+		}
+
+		auto& slot = slot_(handle.index);
+		slot.object().~T();
+		++slot.generation;
+		slot.nextFree = firstFree_;
+		firstFree_ = handle.index;
+		--size_;
+	}
+
+	// Erases the objects for which predicate returns true
+	template <class Predicate>
+	void eraseIf(Predicate predicate) {
+		for (auto it = begin(); it != end(); ) {
+			const auto handle = it.handle();
+			const auto erased = predicate(*it);
+			++it;
+
+			if (erased) {
+				erase(handle);
+			}
+		}
+	}
+
+	void clear() noexcept {
+		eraseIf([](const T&) { return true; });
+	}
+
+	bool contains(Handle handle) const noexcept {
+		return handle.index < capacity() && slot_(handle.index).generation == handle.generation &&
+			slot_(handle.index).alive();
+	}
+
+	// Returns null if handle is stale
+	T* get(Handle handle) noexcept {
+		return contains(handle) ? &slot_(handle.index).object() : nullptr;
+	}
+
+	const T* get(Handle handle) const noexcept {
+		return contains(handle) ? &slot_(handle.index).object() : nullptr;
+	}
+
+	T& operator[](Handle handle) noexcept {
+		assert(contains(handle));
+		return slot_(handle.index).object();
+	}
+
+	const T& operator[](Handle handle) const noexcept {
+		assert(contains(handle));
+		return slot_(handle.index).object();
+	}
+
+	size_t size() const noexcept {
+		return size_;
+	}
+
+	// Number of slots allocated, objects may be added up to capacity without allocating
+	size_t capacity() const noexcept {
+		return chunks_.size() * CHUNK_SIZE;
+	}
+
+	bool empty() const noexcept {
+		return size_ == 0u;
+	}
+
+	iterator begin() noexcept {
+		return iterator(this, 0u);
+	}
+
+	iterator end() noexcept {
+		return iterator(this, capacity());
+	}
+
+	const_iterator begin() const noexcept {
+		return const_iterator(this, 0u);
+	}
+
+	const_iterator end() const noexcept {
+		return const_iterator(this, capacity());
+	}
+
+private:
+
+	static constexpr auto NO_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+	struct Slot {
+
+		std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+		std::uint32_t generation = 0u;
+
+		// Next slot on the free list, meaningless while the slot is in use
+		std::uint32_t nextFree = NO_SLOT;
+
+		bool alive() const noexcept {
+			return (generation % 2u) == 1u;
+		}
+
+		T& object() noexcept {
+			return *std::launder(reinterpret_cast<T*>(&storage));
+		}
+
+		const T& object() const noexcept {
+			return *std::launder(reinterpret_cast<const T*>(&storage));
+		}
+
+	};
+
+	using Chunk = std::unique_ptr<Slot[]>;
+
+	std::vector<Chunk> chunks_;
+
+	size_t size_ = 0u;
+
+	std::uint32_t firstFree_ = NO_SLOT;
+
+	Slot& slot_(size_t index) noexcept {
+		return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE];
+	}
+
+	const Slot& slot_(size_t index) const noexcept {
+		return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE];
+	}
+
+	// Adds a chunk of free slots, only called with the free list empty
+	void grow_() {
+		assert(firstFree_ == NO_SLOT);
+
+		const auto first = capacity();
+		assert(first + CHUNK_SIZE < NO_SLOT);
+
+		chunks_.emplace_back(std::make_unique<Slot[]>(CHUNK_SIZE));
+		for (auto idx = size_t(0); idx + 1u < CHUNK_SIZE; ++idx) {
+			chunks_.back()[idx].nextFree = static_cast<std::uint32_t>(first + idx + 1u);
+		}
+
+		firstFree_ = static_cast<std::uint32_t>(first);
+	}
+
+};
+
+} // namespace dormouse_engine::essentials
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_POOL_HPP_ */
@@ -1,8 +1,11 @@
 #ifndef DORMOUSEENGINE_SINGLETON_SINGLETON_HPP_
 #define DORMOUSEENGINE_SINGLETON_SINGLETON_HPP_
 
+#include <atomic>
+#include <cassert>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 
 #include <boost/noncopyable.hpp>
 
@@ -10,6 +13,10 @@
 
 namespace dormouse_engine::essentials {
 
+// Instance is created by Creator on first access and may be replaced with setInstance. Access is safe from
+// multiple threads. reference() is the fast path: once the instance exists it is a single atomic load, with
+// no locking and no reference counting. The reference is invalidated by setInstance, so it shouldn't be
+// kept by code which may run while the instance is replaced.
 template <
 	class InstanceType,
 	class CreatorType = essentials::policy::creation::New<InstanceType>
@@ -23,38 +30,78 @@ public:
 
 	using Creator = CreatorType;
 
-	static InstancePtr instance() {
-		if (!instance_) {
-			Creator creator;
-			instance_ = creator.create();
-			std::atexit(&Singleton::destroy);
+	static Instance& reference() {
+		auto* instance = current_.load(std::memory_order_acquire);
+
+		if (instance == nullptr) {
+			auto lock = std::unique_lock<std::mutex>(mutex_);
+			instance = create_().get();
 		}
 
-		return instance_;
+		assert(instance != nullptr);
+		return *instance;
+	}
+
+	static InstancePtr instance() {
+		auto lock = std::unique_lock<std::mutex>(mutex_);
+		return create_();
 	}
 
 	static void setInstance(std::unique_ptr<Instance>&& instance) {
-		if (!instance_) {
-			std::atexit(&Singleton::destroy);
+		auto previous = InstancePtr(std::move(instance));
+
+		{
+			auto lock = std::unique_lock<std::mutex>(mutex_);
+			std::call_once(destroyRegistered_, []() { std::atexit(&Singleton::destroy); });
+			instance_.swap(previous);
+			current_.store(instance_.get(), std::memory_order_release);
 		}
-		instance_.reset(instance.release());
+
+		// the previous instance is destroyed outside the lock, in case its destructor accesses the singleton
 	}
 
 private:
 
+	static std::mutex mutex_;
+
+	static std::once_flag destroyRegistered_;
+
 	static InstancePtr instance_;
 
-	static void destroy() {
-		if (instance_) {
-			instance_.reset();
+	// Copy of instance_.get(), read without locking mutex_
+	static std::atomic<Instance*> current_;
+
+	// Creates the instance if there is none. mutex_ must be locked.
+	static const InstancePtr& create_() {
+		if (!instance_) {
+			Creator creator;
+			instance_ = creator.create();
+			current_.store(instance_.get(), std::memory_order_release);
+			std::call_once(destroyRegistered_, []() { std::atexit(&Singleton::destroy); });
 		}
+
+		return instance_;
+	}
+
+	static void destroy() {
+		setInstance(nullptr);
 	}
 
 };
 
+template <class InstanceType, class Creator>
+std::mutex Singleton<InstanceType, Creator>::mutex_;
+
+template <class InstanceType, class Creator>
+std::once_flag Singleton<InstanceType, Creator>::destroyRegistered_;
+
 template <class InstanceType, class Creator>
 typename Singleton<InstanceType, Creator>::InstancePtr Singleton<InstanceType, Creator>::instance_;
 
+template <class InstanceType, class Creator>
+std::atomic<typename Singleton<InstanceType, Creator>::Instance*>
+	Singleton<InstanceType, Creator>::current_ = nullptr;
+
 } // namespace dormouse_engine::essentials
 
 #endif /* DORMOUSEENGINE_SINGLETON_SINGLETON_HPP_ */
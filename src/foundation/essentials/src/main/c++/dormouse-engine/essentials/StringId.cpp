@@ -3,6 +3,23 @@
 using namespace dormouse_engine;
 using namespace dormouse_engine::essentials;
 
+namespace /* anonymous */ {
+
+// Constant-initialised, so literals registered during dynamic initialisation of other units find it ready
+std::atomic<const detail::StringLiteral*> stringLiterals = nullptr;
+
+const detail::StringLiteral* findLiteral(std::uint64_t hash) noexcept {
+	for (auto* literal = detail::StringLiteral::first(); literal != nullptr; literal = literal->next()) {
+		if (literal->hash() == hash) {
+			return literal;
+		}
+	}
+
+	return nullptr;
+}
+
+} // anonymous namespace
+
 ClashingStringIdHash::ClashingStringIdHash(std::string stored, std::string added) :
 	exceptions::RuntimeError(
 		"Clashin StringId hash for. New string: \"" + std::move(added) +
@@ -11,15 +28,100 @@ ClashingStringIdHash::ClashingStringIdHash(std::string stored, std::string added
 {
 }
 
-StringId Strings::add(std::string s) {
-	const auto hash = std::hash<std::string>()(s);
-	const auto it = registry_.find(hash);
+UnknownStringIdHash::UnknownStringIdHash(std::uint64_t hash) :
+	exceptions::RuntimeError("No string stored for StringId hash " + std::to_string(hash))
+{
+}
+
+detail::StringLiteral::StringLiteral(const char* text, size_t size) noexcept :
+	hash_(hashBytes(text, size)),
+	text_(text, size),
+	next_(stringLiterals.load(std::memory_order_relaxed))
+{
+	while (!stringLiterals.compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+}
+
+const detail::StringLiteral* detail::StringLiteral::first() noexcept {
+	return stringLiterals.load(std::memory_order_acquire);
+}
+
+Strings::Shard::Shard() noexcept {
+	for (auto& bucket : buckets) {
+		bucket.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+StringId Strings::add(std::string_view s) {
+	const auto hash = hashBytes(s.data(), s.size());
+	auto& shard = shard_(hash);
+
+	const auto* entry = find_(shard, hash);
+	if (entry == nullptr) {
+		auto lock = std::unique_lock<std::mutex>(shard.mutex);
+		const auto* literal = findLiteral(hash);
+		entry = &insert_(shard, hash, (literal == nullptr) ? s : literal->text());
+	}
 
-	if (it != registry_.end() && it->second != s) {
-		throw ClashingStringIdHash(it->second, std::move(s));
-	} else {
-		registry_.emplace_hint(it, hash, std::move(s));
+	if (entry->string != s) {
+		throw ClashingStringIdHash(entry->string, std::string(s));
 	}
 
 	return hash;
 }
+
+size_t Strings::size() const noexcept {
+	return size_.load(std::memory_order_relaxed);
+}
+
+const std::string& Strings::get(StringId::Hash hash) {
+	auto& shard = shard_(hash);
+
+	const auto* entry = find_(shard, hash);
+	if (entry == nullptr) {
+		// strings added to a replaced Strings instance are lost, only literals are always known
+		const auto* literal = findLiteral(hash);
+		if (literal == nullptr) {
+			throw UnknownStringIdHash(hash);
+		}
+
+		auto lock = std::unique_lock<std::mutex>(shard.mutex);
+		entry = &insert_(shard, hash, literal->text());
+	}
+
+	return entry->string;
+}
+
+Strings::Shard& Strings::shard_(StringId::Hash hash) noexcept {
+	// the low bits select the bucket
+	return shards_[(hash >> 56) % SHARD_COUNT];
+}
+
+Strings::Shard::Buckets::value_type& Strings::bucket_(Shard& shard, StringId::Hash hash) noexcept {
+	return shard.buckets[hash % BUCKET_COUNT];
+}
+
+const Strings::Entry* Strings::find_(Shard& shard, StringId::Hash hash) noexcept {
+	for (auto* entry = bucket_(shard, hash).load(std::memory_order_acquire); entry != nullptr; entry = entry->next) {
+		if (entry->hash == hash) {
+			return entry;
+		}
+	}
+
+	return nullptr;
+}
+
+const Strings::Entry& Strings::insert_(Shard& shard, StringId::Hash hash, std::string_view s) {
+	// another thread may have added the entry between the caller's lookup and locking the shard
+	if (const auto* entry = find_(shard, hash)) {
+		return *entry;
+	}
+
+	auto& bucket = bucket_(shard, hash);
+	const auto& entry =
+		shard.entries.emplace_back(Entry{ hash, std::string(s), bucket.load(std::memory_order_relaxed) });
+	bucket.store(&entry, std::memory_order_release);
+	size_.fetch_add(1u, std::memory_order_relaxed);
+
+	return entry;
+}
@@ -1,17 +1,21 @@
 #ifndef DORMOUSEENGINE_ESSENTIALS_STRINGID_HPP_
 #define DORMOUSEENGINE_ESSENTIALS_STRINGID_HPP_
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <deque>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <cstdint>
 #include <iosfwd>
+#include <mutex>
 
 #include <boost/operators.hpp>
 
 #include "dormouse-engine/exceptions/RuntimeError.hpp"
 #include "Singleton.hpp"
-#include "functional.hpp"
+#include "hash-bytes.hpp"
 
 namespace dormouse_engine::essentials {
 
@@ -22,6 +26,80 @@ public:
 
 };
 
+class UnknownStringIdHash : public exceptions::RuntimeError {
+public:
+
+	explicit UnknownStringIdHash(std::uint64_t hash);
+
+};
+
+namespace detail {
+
+// String literal usable as a template argument
+template <size_t N>
+struct FixedString {
+
+	char text[N] = {};
+
+	constexpr FixedString(const char (&s)[N]) noexcept {
+		for (auto idx = size_t(0); idx < N; ++idx) {
+			text[idx] = s[idx];
+		}
+	}
+
+	constexpr size_t size() const noexcept {
+		return N - 1u;
+	}
+
+};
+
+// Text of a StringId literal. Each one is created before main and pushed onto a lock-free list, from which
+// Strings takes it the first time its string is asked for.
+class StringLiteral {
+public:
+
+	StringLiteral(const char* text, size_t size) noexcept;
+
+	std::uint64_t hash() const noexcept {
+		return hash_;
+	}
+
+	std::string_view text() const noexcept {
+		return text_;
+	}
+
+	const StringLiteral* next() const noexcept {
+		return next_;
+	}
+
+	static const StringLiteral* first() noexcept;
+
+private:
+
+	std::uint64_t hash_;
+
+	std::string_view text_;
+
+	const StringLiteral* next_;
+
+};
+
+template <FixedString S>
+inline const auto stringLiteral = StringLiteral(S.text, S.size());
+
+} // namespace detail
+
+class StringId;
+
+namespace string_id_literals {
+
+template <detail::FixedString S>
+constexpr StringId operator""_sid() noexcept;
+
+} // namespace string_id_literals
+
+// Name identified by a hash of its text. StringIds created from strings at run time register the text in
+// Strings. The "text"_sid literal computes the hash at compile time and neither allocates nor locks.
 class StringId : boost::equality_comparable<StringId> {
 public:
 
@@ -29,22 +107,20 @@ public:
 
 	StringId(std::string s);
 
-	StringId(const char* cs) :
-		StringId(std::string(cs))
-	{
-	}
+	StringId(const char* cs);
 
-	const std::string& string() const noexcept;
+	const std::string& string() const;
 
 private:
 
-	using Hash = std::size_t;
+	// 64-bit FNV-1a, so that hashes of literals may be computed at compile time
+	using Hash = std::uint64_t;
 
-	static const auto INVALID_HASH = static_cast<Hash>(-1);
+	static constexpr auto INVALID_HASH = static_cast<Hash>(-1);
 
 	Hash hash_ = INVALID_HASH;
 
-	StringId(Hash hash) :
+	constexpr StringId(Hash hash) noexcept :
 		hash_(hash)
 	{
 	}
@@ -53,6 +129,9 @@ private:
 		return lhs.hash_ == rhs.hash_;
 	}
 
+	template <detail::FixedString S>
+	friend constexpr StringId string_id_literals::operator""_sid() noexcept;
+
 	friend class Strings;
 
 	friend struct std::hash<StringId>;
@@ -63,37 +142,94 @@ inline std::ostream& operator<<(std::ostream& os, StringId stringId) {
 	return os << stringId.string();
 }
 
+// Registry of strings of StringIds. Strings are never removed, so references to them stay valid for the
+// lifetime of the registry. Entries are spread over shards by hash, each with a fixed array of bucket chains.
+// Entries are published to chains atomically and never change afterwards, so lookups don't lock. Only adding
+// a new string locks, and only the mutex of its shard.
 class Strings : public essentials::Singleton<Strings> {
 public:
 
-	StringId add(std::string s);
+	StringId add(std::string_view s);
+
+	size_t size() const noexcept;
 
 private:
 
-	using Registry = std::unordered_map<StringId::Hash, std::string, Identity>;
+	static constexpr auto SHARD_COUNT = size_t(16);
 
-	Registry registry_;
+	static constexpr auto BUCKET_COUNT = size_t(256);
 
-	const std::string& get(StringId::Hash hash) const {
-		const auto it = registry_.find(hash);
-		assert(it != registry_.end());
-		return it->second;
-	}
+	struct Entry {
+
+		StringId::Hash hash;
+
+		std::string string;
+
+		const Entry* next;
+
+	};
+
+	struct Shard {
+
+		using Buckets = std::array<std::atomic<const Entry*>, BUCKET_COUNT>;
+
+		// Serialises insertion into this shard
+		std::mutex mutex;
+
+		Buckets buckets;
+
+		// Owns the entries, std::deque doesn't move elements on insertion at the end
+		std::deque<Entry> entries;
+
+		Shard() noexcept;
+
+	};
+
+	std::array<Shard, SHARD_COUNT> shards_;
+
+	std::atomic<size_t> size_ = 0u;
+
+	const std::string& get(StringId::Hash hash);
+
+	static Shard::Buckets::value_type& bucket_(Shard& shard, StringId::Hash hash) noexcept;
+
+	Shard& shard_(StringId::Hash hash) noexcept;
+
+	static const Entry* find_(Shard& shard, StringId::Hash hash) noexcept;
+
+	// Finds the entry for hash in shard or adds one with the given string. The shard must be locked.
+	const Entry& insert_(Shard& shard, StringId::Hash hash, std::string_view s);
 
 	friend class StringId;
 
 };
 
 inline StringId::StringId(std::string s) :
-	StringId(Strings::instance()->add(std::move(s)))
+	StringId(Strings::reference().add(s))
+{
+}
+
+inline StringId::StringId(const char* cs) :
+	StringId(Strings::reference().add(cs))
 {
 }
 
-inline const std::string& StringId::string() const noexcept {
+inline const std::string& StringId::string() const {
 	assert(hash_ != INVALID_HASH);
-	return Strings::instance()->get(hash_);
+	return Strings::reference().get(hash_);
 }
 
+namespace string_id_literals {
+
+template <detail::FixedString S>
+constexpr StringId operator""_sid() noexcept {
+	// odr-using the literal's text has it registered on startup
+	static_cast<void>(&detail::stringLiteral<S>);
+	return StringId(hashBytes(S.text, S.size()));
+}
+
+} // namespace string_id_literals
+
 } // namespace dormouse_engine::essentials
 
 namespace std {
@@ -101,8 +237,8 @@ namespace std {
 template <>
 struct hash<dormouse_engine::essentials::StringId> {
 
-	auto operator()(const dormouse_engine::essentials::StringId& stringId) const noexcept {
-		return stringId.hash_;
+	size_t operator()(const dormouse_engine::essentials::StringId& stringId) const noexcept {
+		return static_cast<size_t>(stringId.hash_);
 	}
 
 };
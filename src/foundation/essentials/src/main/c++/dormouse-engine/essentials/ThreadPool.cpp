@@ -0,0 +1,55 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+using namespace dormouse_engine::essentials;
+
+ThreadPool::ThreadPool(size_t threadCount) {
+	const auto workerCount = std::max<size_t>(threadCount, 1u);
+	workers_.reserve(workerCount);
+	for (auto workerIdx = size_t(0); workerIdx < workerCount; ++workerIdx) {
+		workers_.emplace_back([this]() { work_(); });
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		auto lock = std::unique_lock<std::mutex>(mutex_);
+		stopping_ = true;
+	}
+
+	taskAvailable_.notify_all();
+
+	for (auto& worker : workers_) {
+		worker.join();
+	}
+}
+
+void ThreadPool::push_(Task task) {
+	{
+		auto lock = std::unique_lock<std::mutex>(mutex_);
+		tasks_.emplace_back(std::move(task));
+	}
+
+	taskAvailable_.notify_one();
+}
+
+void ThreadPool::work_() {
+	for (;;) {
+		auto task = Task();
+
+		{
+			auto lock = std::unique_lock<std::mutex>(mutex_);
+			taskAvailable_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+
+			if (tasks_.empty()) {
+				return;
+			}
+
+			task = std::move(tasks_.front());
+			tasks_.pop_front();
+		}
+
+		task();
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_THREADPOOL_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_THREADPOOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace dormouse_engine::essentials {
+
+// Fixed set of worker threads executing submitted tasks in submission order. Results and exceptions are
+// passed through the returned futures. Tasks must not wait for other tasks of the same pool, as all workers
+// may be blocked that way. The destructor executes the remaining tasks before joining the workers.
+class ThreadPool final {
+public:
+
+	explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+
+	ThreadPool(const ThreadPool&) = delete;
+
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool();
+
+	template <class Func>
+	std::future<std::invoke_result_t<Func>> submit(Func func);
+
+	size_t threadCount() const noexcept {
+		return workers_.size();
+	}
+
+private:
+
+	using Task = std::function<void ()>;
+
+	std::mutex mutex_;
+
+	std::condition_variable taskAvailable_;
+
+	std::deque<Task> tasks_;
+
+	bool stopping_ = false;
+
+	std::vector<std::thread> workers_;
+
+	void push_(Task task);
+
+	void work_();
+
+};
+
+template <class Func>
+std::future<std::invoke_result_t<Func>> ThreadPool::submit(Func func) {
+	using Result = std::invoke_result_t<Func>;
+
+	// std::function requires a copyable target
+	auto task = std::make_shared<std::packaged_task<Result ()>>(std::move(func));
+	auto result = task->get_future();
+
+	push_([task]() { (*task)(); });
+
+	return result;
+}
+
+} // namespace dormouse_engine::essentials
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_THREADPOOL_HPP_ */
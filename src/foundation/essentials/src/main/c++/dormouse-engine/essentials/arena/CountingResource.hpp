@@ -0,0 +1,74 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_ARENA_COUNTINGRESOURCE_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_ARENA_COUNTINGRESOURCE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+namespace dormouse_engine::essentials::arena {
+
+// Memory resource forwarding to upstream and counting what passes through it. Used as the upstream of
+// arenas and pmr containers to check that code doesn't allocate in steady state. Safe to use from multiple
+// threads if upstream is.
+class CountingResource final : public std::pmr::memory_resource {
+public:
+
+	struct Statistics {
+
+		size_t allocations = 0u;
+
+		size_t deallocations = 0u;
+
+		size_t allocatedBytes = 0u;
+
+	};
+
+	explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept :
+		upstream_(upstream)
+	{
+	}
+
+	Statistics statistics() const noexcept {
+		auto statistics = Statistics();
+		statistics.allocations = allocations_.load(std::memory_order_relaxed);
+		statistics.deallocations = deallocations_.load(std::memory_order_relaxed);
+		statistics.allocatedBytes = allocatedBytes_.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	// Allocations not deallocated yet
+	size_t liveAllocations() const noexcept {
+		return allocations_.load(std::memory_order_relaxed) - deallocations_.load(std::memory_order_relaxed);
+	}
+
+private:
+
+	std::pmr::memory_resource* upstream_;
+
+	std::atomic<size_t> allocations_ = 0u;
+
+	std::atomic<size_t> deallocations_ = 0u;
+
+	std::atomic<size_t> allocatedBytes_ = 0u;
+
+	void* do_allocate(size_t bytes, size_t alignment) override {
+		auto* result = upstream_->allocate(bytes, alignment);
+		allocations_.fetch_add(1u, std::memory_order_relaxed);
+		allocatedBytes_.fetch_add(bytes, std::memory_order_relaxed);
+		return result;
+	}
+
+	void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+		upstream_->deallocate(p, bytes, alignment);
+		deallocations_.fetch_add(1u, std::memory_order_relaxed);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+
+};
+
+} // namespace dormouse_engine::essentials::arena
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_ARENA_COUNTINGRESOURCE_HPP_ */
@@ -0,0 +1,84 @@
+#include "MonotonicArena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+using namespace dormouse_engine::essentials::arena;
+
+MonotonicArena::MonotonicArena(size_t blockSize, std::pmr::memory_resource* upstream) :
+	blockSize_(blockSize),
+	upstream_(upstream),
+	resource_(*this)
+{
+	assert(blockSize_ > 0u);
+}
+
+MonotonicArena::~MonotonicArena() {
+	for (const auto& block : blocks_) {
+		upstream_->deallocate(block.data, block.size, alignof(std::max_align_t));
+	}
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment) {
+	assert(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+
+	++statistics_.allocations;
+	statistics_.allocatedBytes += size;
+
+	if (auto* result = allocateFromBlock_(size, alignment)) {
+		return result;
+	}
+
+	// blocks after the current one are free after a rewind, the first large enough is used
+	const auto requiredSize = size + std::max(alignment, alignof(std::max_align_t));
+	for (++blockIdx_; blockIdx_ < blocks_.size(); ++blockIdx_) {
+		offset_ = 0u;
+		if (auto* result = allocateFromBlock_(size, alignment)) {
+			return result;
+		}
+	}
+
+	const auto newBlockSize = std::max(blockSize_, requiredSize);
+	auto* data = static_cast<std::byte*>(upstream_->allocate(newBlockSize, alignof(std::max_align_t)));
+	blocks_.push_back(Block{ data, newBlockSize });
+	++statistics_.blockAllocations;
+
+	blockIdx_ = blocks_.size() - 1u;
+	offset_ = 0u;
+
+	auto* result = allocateFromBlock_(size, alignment);
+	assert(result != nullptr);
+	return result;
+}
+
+void MonotonicArena::rewind(Marker marker) noexcept {
+	assert(marker.blockIdx < blockIdx_ || (marker.blockIdx == blockIdx_ && marker.offset <= offset_));
+	blockIdx_ = marker.blockIdx;
+	offset_ = marker.offset;
+}
+
+size_t MonotonicArena::capacity() const noexcept {
+	auto capacity = size_t(0);
+	for (const auto& block : blocks_) {
+		capacity += block.size;
+	}
+	return capacity;
+}
+
+void* MonotonicArena::allocateFromBlock_(size_t size, size_t alignment) noexcept {
+	if (blockIdx_ >= blocks_.size()) {
+		return nullptr;
+	}
+
+	const auto& block = blocks_[blockIdx_];
+	const auto address = reinterpret_cast<std::uintptr_t>(block.data) + offset_;
+	const auto alignedOffset = offset_ + (((address + alignment - 1u) & ~(alignment - 1u)) - address);
+
+	if (alignedOffset + size > block.size) {
+		return nullptr;
+	}
+
+	offset_ = alignedOffset + size;
+	return block.data + alignedOffset;
+}
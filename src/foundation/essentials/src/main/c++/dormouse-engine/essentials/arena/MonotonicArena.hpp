@@ -0,0 +1,137 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_ARENA_MONOTONICARENA_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_ARENA_MONOTONICARENA_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace dormouse_engine::essentials::arena {
+
+// Bump allocator over blocks of memory taken from an upstream resource. Individual allocations are never
+// freed - the arena is rewound as a whole, either to a marker or, with reset(), to the start. Blocks are kept
+// when rewinding, so an arena reset every frame stops allocating from upstream once it has grown to the
+// largest frame's needs. Allocations larger than the block size get a block of their own.
+// resource() adapts the arena to std::pmr containers, which then must not outlive the next rewind.
+// Not safe to use from multiple threads.
+class MonotonicArena final : boost::noncopyable {
+public:
+
+	static constexpr auto DEFAULT_BLOCK_SIZE = size_t(64 * 1024);
+
+	struct Statistics {
+
+		size_t allocations = 0u;
+
+		size_t allocatedBytes = 0u;
+
+		size_t blockAllocations = 0u;
+
+	};
+
+	// Position in the arena to rewind to
+	struct Marker {
+
+		size_t blockIdx = 0u;
+
+		size_t offset = 0u;
+
+	};
+
+	explicit MonotonicArena(
+		size_t blockSize = DEFAULT_BLOCK_SIZE,
+		std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+		);
+
+	~MonotonicArena();
+
+	// alignment must be a power of two
+	void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	template <class T>
+	T* allocate(size_t count = 1u) {
+		return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+	}
+
+	Marker mark() const noexcept {
+		return Marker{ blockIdx_, offset_ };
+	}
+
+	// Releases everything allocated after marker was taken
+	void rewind(Marker marker) noexcept;
+
+	void reset() noexcept {
+		rewind(Marker());
+	}
+
+	std::pmr::memory_resource* resource() noexcept {
+		return &resource_;
+	}
+
+	// Total size of the blocks held
+	size_t capacity() const noexcept;
+
+	const Statistics& statistics() const noexcept {
+		return statistics_;
+	}
+
+private:
+
+	class Resource final : public std::pmr::memory_resource {
+	public:
+
+		explicit Resource(MonotonicArena& arena) noexcept :
+			arena_(arena)
+		{
+		}
+
+	private:
+
+		MonotonicArena& arena_;
+
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			return arena_.allocate(bytes, alignment);
+		}
+
+		void do_deallocate(
+			[[maybe_unused]] void* p, [[maybe_unused]] size_t bytes, [[maybe_unused]] size_t alignment) override
+		{
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+
+	};
+
+	struct Block {
+
+		std::byte* data;
+
+		size_t size;
+
+	};
+
+	size_t blockSize_;
+
+	std::pmr::memory_resource* upstream_;
+
+	Resource resource_;
+
+	std::vector<Block> blocks_;
+
+	size_t blockIdx_ = 0u;
+
+	size_t offset_ = 0u;
+
+	Statistics statistics_;
+
+	// Allocates from the block at blockIdx_, returns null if it doesn't have enough space left
+	void* allocateFromBlock_(size_t size, size_t alignment) noexcept;
+
+};
+
+} // namespace dormouse_engine::essentials::arena
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_ARENA_MONOTONICARENA_HPP_ */
@@ -0,0 +1,8 @@
+#include "scratch.hpp"
+
+using namespace dormouse_engine::essentials::arena;
+
+MonotonicArena& dormouse_engine::essentials::arena::scratchArena() {
+	thread_local auto arena = MonotonicArena();
+	return arena;
+}
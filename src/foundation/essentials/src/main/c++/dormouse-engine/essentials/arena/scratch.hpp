@@ -0,0 +1,49 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_ARENA_SCRATCH_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_ARENA_SCRATCH_HPP_
+
+#include <memory_resource>
+
+#include <boost/noncopyable.hpp>
+
+#include "MonotonicArena.hpp"
+
+namespace dormouse_engine::essentials::arena {
+
+// Arena of the calling thread for short-lived temporaries. Memory allocated from it should be scoped with
+// ScratchScope rather than allocated directly.
+MonotonicArena& scratchArena();
+
+// Rewinds the calling thread's scratch arena on destruction to where it was on construction. Scopes may be
+// nested, but must be destroyed in reverse order of construction, on the thread which created them.
+class ScratchScope final : boost::noncopyable {
+public:
+
+	ScratchScope() noexcept :
+		arena_(scratchArena()),
+		marker_(arena_.mark())
+	{
+	}
+
+	~ScratchScope() noexcept {
+		arena_.rewind(marker_);
+	}
+
+	void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+		return arena_.allocate(size, alignment);
+	}
+
+	std::pmr::memory_resource* resource() noexcept {
+		return arena_.resource();
+	}
+
+private:
+
+	MonotonicArena& arena_;
+
+	MonotonicArena::Marker marker_;
+
+};
+
+} // namespace dormouse_engine::essentials::arena
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_ARENA_SCRATCH_HPP_ */
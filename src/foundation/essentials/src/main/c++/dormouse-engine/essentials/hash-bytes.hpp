@@ -0,0 +1,32 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_HASH_BYTES_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_HASH_BYTES_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+namespace dormouse_engine::essentials {
+
+constexpr auto FNV1A_OFFSET_BASIS = std::uint64_t(0xcbf29ce484222325ull);
+
+constexpr auto FNV1A_PRIME = std::uint64_t(0x100000001b3ull);
+
+// 64-bit FNV-1a hash of size bytes. Pass the result of a previous call as seed to hash data spread over
+// multiple buffers.
+template <class ByteType>
+constexpr std::uint64_t hashBytes(
+	const ByteType* data, size_t size, std::uint64_t seed = FNV1A_OFFSET_BASIS) noexcept
+{
+	static_assert(sizeof(ByteType) == 1u, "hashBytes expects a byte buffer");
+
+	auto hash = seed;
+	for (auto idx = size_t(0); idx < size; ++idx) {
+		hash ^= static_cast<std::uint8_t>(data[idx]);
+		hash *= FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+} // namespace dormouse_engine::essentials
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_HASH_BYTES_HPP_ */
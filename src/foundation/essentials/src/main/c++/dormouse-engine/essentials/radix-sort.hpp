@@ -0,0 +1,78 @@
+#ifndef _DORMOUSEENGINE_ESSENTIALS_RADIX_SORT_HPP_
+#define _DORMOUSEENGINE_ESSENTIALS_RADIX_SORT_HPP_
+
+#include <array>
+#include <climits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dormouse_engine::essentials {
+
+// Stable LSD radix sort of values by the unsigned integer key returned by keyFunc. Byte columns in which
+// all keys are equal are skipped. buffer is used as scratch space and keeps its capacity, so passing the
+// same buffer every call avoids allocations. keyFunc is called sizeof(Key) + 1 times per value, so it
+// should be cheap (e.g. read a precomputed key).
+template <class T, class KeyFunc>
+void radixSort(std::vector<T>& values, std::vector<T>& buffer, KeyFunc keyFunc) {
+	using Key = std::decay_t<decltype(keyFunc(std::declval<const T&>()))>;
+	static_assert(std::is_unsigned_v<Key>, "Radix sort requires unsigned integer keys");
+
+	constexpr auto RADIX_BITS = size_t(CHAR_BIT);
+	constexpr auto BUCKET_COUNT = size_t(1) << RADIX_BITS;
+	constexpr auto COLUMN_COUNT = sizeof(Key);
+
+	if (values.size() < 2u) {
+		return;
+	}
+
+	auto histograms = std::array<std::array<size_t, BUCKET_COUNT>, COLUMN_COUNT>();
+	for (auto& histogram : histograms) {
+		histogram.fill(0u);
+	}
+
+	for (const auto& value : values) {
+		auto key = keyFunc(value);
+		for (auto& histogram : histograms) {
+			++histogram[key & (BUCKET_COUNT - 1)];
+			key = static_cast<Key>(key >> RADIX_BITS);
+		}
+	}
+
+	buffer.resize(values.size());
+
+	auto* source = &values;
+	auto* target = &buffer;
+
+	for (auto column = size_t(0); column < COLUMN_COUNT; ++column) {
+		const auto shift = column * RADIX_BITS;
+		const auto& histogram = histograms[column];
+
+		const auto firstBucket = (keyFunc(values.front()) >> shift) & (BUCKET_COUNT - 1);
+		if (histogram[firstBucket] == values.size()) {
+			continue;
+		}
+
+		auto offsets = std::array<size_t, BUCKET_COUNT>();
+		auto offset = size_t(0);
+		for (auto bucket = size_t(0); bucket < BUCKET_COUNT; ++bucket) {
+			offsets[bucket] = offset;
+			offset += histogram[bucket];
+		}
+
+		for (const auto& value : *source) {
+			const auto bucket = (keyFunc(value) >> shift) & (BUCKET_COUNT - 1);
+			(*target)[offsets[bucket]++] = value;
+		}
+
+		std::swap(source, target);
+	}
+
+	if (source != &values) {
+		values.swap(buffer);
+	}
+}
+
+} // namespace dormouse_engine::essentials
+
+#endif /* _DORMOUSEENGINE_ESSENTIALS_RADIX_SORT_HPP_ */
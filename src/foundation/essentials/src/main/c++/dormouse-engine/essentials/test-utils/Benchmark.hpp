@@ -0,0 +1,74 @@
+#ifndef DORMOUSEENGINE_ESSENTIALS_TEST_UTILS_BENCHMARK_HPP_
+#define DORMOUSEENGINE_ESSENTIALS_TEST_UTILS_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace dormouse_engine::essentials::test_utils {
+
+struct BenchmarkResult {
+
+	using Duration = std::chrono::duration<double, std::micro>;
+
+	Duration mean;
+
+	Duration min;
+
+	Duration max;
+
+};
+
+inline std::ostream& operator<<(std::ostream& os, const BenchmarkResult& result) {
+	return os
+		<< "mean: " << result.mean.count() << "us, "
+		<< "min: " << result.min.count() << "us, "
+		<< "max: " << result.max.count() << "us"
+		;
+}
+
+// Runs setup and func once to warm up and then iterations times, reporting timings of func to std::cout.
+// Time spent in setup is not measured.
+template <class SetupFunc, class Func>
+BenchmarkResult benchmark(const std::string& name, size_t iterations, SetupFunc&& setup, Func&& func) {
+	using Clock = std::chrono::steady_clock;
+
+	setup();
+	func();
+
+	auto result = BenchmarkResult();
+	result.min = BenchmarkResult::Duration::max();
+	result.max = BenchmarkResult::Duration::zero();
+
+	auto total = BenchmarkResult::Duration::zero();
+
+	for (auto iteration = size_t(0); iteration < iterations; ++iteration) {
+		setup();
+
+		const auto start = Clock::now();
+		func();
+		const auto duration = std::chrono::duration_cast<BenchmarkResult::Duration>(Clock::now() - start);
+
+		total += duration;
+		result.min = std::min(result.min, duration);
+		result.max = std::max(result.max, duration);
+	}
+
+	result.mean = total / static_cast<double>(std::max<size_t>(iterations, 1u));
+
+	std::cout << name << " (" << iterations << " iterations) - " << result << std::endl;
+
+	return result;
+}
+
+// Runs func once to warm up and then iterations times, reporting timings to std::cout.
+template <class Func>
+BenchmarkResult benchmark(const std::string& name, size_t iterations, Func&& func) {
+	return benchmark(name, iterations, []() {}, std::forward<Func>(func));
+}
+
+} // namespace dormouse_engine::essentials::test_utils
+
+#endif /* DORMOUSEENGINE_ESSENTIALS_TEST_UTILS_BENCHMARK_HPP_ */
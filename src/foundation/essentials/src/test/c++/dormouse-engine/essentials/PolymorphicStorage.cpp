@@ -14,6 +14,7 @@ DE_ENUM(
 	(INT)
 	(FLOAT)
 	(CONSTRUCTION_REGISTERING_OBJECT)
+	(LARGE)
 );
 
 class Concept : public ConceptBase {
@@ -58,6 +59,16 @@ Version version(const test_utils::ConstructionRegisteringObject&) {
 	return Version::CONSTRUCTION_REGISTERING_OBJECT;
 }
 
+struct Large {
+
+	int values[16];
+
+};
+
+Version version(const Large&) {
+	return Version::LARGE;
+}
+
 using Storage = PolymorphicStorage<Concept, Model, 2 * sizeof(void*), alignof(void*)>;
 
 BOOST_AUTO_TEST_SUITE(PolymorphicStorageTestSuite);
@@ -105,6 +116,57 @@ BOOST_AUTO_TEST_CASE(HasValueSemantics) {
 	BOOST_CHECK_EQUAL(storage->version(), Version::FLOAT);
 }
 
+BOOST_AUTO_TEST_CASE(StoresLargeModelsOnHeap) {
+	auto large = Large();
+	large.values[15] = 42;
+
+	auto storage = Storage(large);
+	BOOST_CHECK(storage.onHeap());
+	BOOST_CHECK(!Storage(42).onHeap());
+	BOOST_CHECK_EQUAL(storage->version(), Version::LARGE);
+
+	const auto copy = storage;
+	BOOST_CHECK_NE(copy->modelPtr(), storage->modelPtr());
+	BOOST_CHECK_EQUAL(static_cast<const Large*>(copy->modelPtr())->values[15], 42);
+
+	const auto* modelPtr = storage->modelPtr();
+	const auto moved = std::move(storage);
+	BOOST_CHECK_EQUAL(moved->modelPtr(), modelPtr);
+
+	storage = Storage(2.0f);
+	BOOST_CHECK(!storage.onHeap());
+	BOOST_CHECK_EQUAL(storage->version(), Version::FLOAT);
+}
+
+BOOST_AUTO_TEST_CASE(CopiesTriviallyCopyableModels) {
+	auto storage = Storage(42);
+	auto copy = storage;
+
+	BOOST_CHECK_NE(copy->modelPtr(), storage->modelPtr());
+	BOOST_CHECK_EQUAL(*static_cast<const int*>(copy->modelPtr()), 42);
+	BOOST_CHECK_EQUAL(copy->version(), Version::INT);
+
+	auto registry = test_utils::ConstructionRegistry();
+	copy = Storage(test_utils::ConstructionRegisteringObject(registry));
+	copy = storage;
+	BOOST_CHECK_EQUAL(copy->version(), Version::INT);
+}
+
+BOOST_AUTO_TEST_CASE(DestroysInlineModelWhenMovedFrom) {
+	auto registry = test_utils::ConstructionRegistry();
+
+	auto storage = Storage(test_utils::ConstructionRegisteringObject(registry));
+	BOOST_REQUIRE(!storage.onHeap());
+	const auto* modelPtr = storage->modelPtr();
+
+	const auto moved = std::move(storage);
+	BOOST_CHECK(registry.objects[modelPtr].destructed);
+	BOOST_CHECK(!registry.objects[moved->modelPtr()].destructed);
+
+	storage = Storage(42);
+	BOOST_CHECK_EQUAL(storage->version(), Version::INT);
+}
+
 BOOST_AUTO_TEST_SUITE_END(/* PolymorphicStorageTestSuite */);
 
 } // anonymous namespace
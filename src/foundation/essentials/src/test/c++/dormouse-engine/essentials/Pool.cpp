@@ -0,0 +1,136 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+#include "dormouse-engine/essentials/test-utils/ConstructionRegisteringObject.hpp"
+#include "dormouse-engine/essentials/Pool.hpp"
+
+using namespace dormouse_engine::essentials;
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(PoolTestSuite);
+
+BOOST_AUTO_TEST_CASE(StoresObjectsAccessibleByHandles) {
+	auto pool = Pool<std::string>();
+
+	const auto first = pool.emplace("first");
+	const auto second = pool.emplace(3u, 'x');
+
+	BOOST_CHECK_EQUAL(pool.size(), 2u);
+	BOOST_CHECK_EQUAL(pool[first], "first");
+	BOOST_CHECK_EQUAL(*pool.get(second), "xxx");
+	BOOST_CHECK(first != second);
+}
+
+BOOST_AUTO_TEST_CASE(DetectsStaleHandles) {
+	auto pool = Pool<int>();
+
+	const auto erased = pool.emplace(1);
+	pool.erase(erased);
+	const auto reused = pool.emplace(2);
+
+	BOOST_CHECK_EQUAL(erased.index, reused.index);
+	BOOST_CHECK(!pool.contains(erased));
+	BOOST_CHECK(pool.get(erased) == nullptr);
+	BOOST_CHECK(pool.contains(reused));
+	BOOST_CHECK(!pool.contains(Pool<int>::Handle()));
+
+	pool.erase(erased);
+	BOOST_CHECK_EQUAL(pool.size(), 1u);
+	BOOST_CHECK_EQUAL(pool[reused], 2);
+}
+
+BOOST_AUTO_TEST_CASE(GrowsInChunksWithoutMovingObjects) {
+	auto pool = Pool<int, 4u>();
+
+	auto handles = std::vector<Pool<int, 4u>::Handle>();
+	auto objects = std::vector<const int*>();
+	for (auto idx = 0; idx < 10; ++idx) {
+		handles.emplace_back(pool.emplace(idx));
+		objects.emplace_back(pool.get(handles.back()));
+	}
+
+	BOOST_CHECK_EQUAL(pool.size(), 10u);
+	BOOST_CHECK_EQUAL(pool.capacity(), 12u);
+	for (auto idx = size_t(0); idx < handles.size(); ++idx) {
+		BOOST_CHECK_EQUAL(pool.get(handles[idx]), objects[idx]);
+		BOOST_CHECK_EQUAL(pool[handles[idx]], static_cast<int>(idx));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReusesFreeSlotsBeforeGrowing) {
+	auto pool = Pool<int, 4u>();
+
+	for (auto idx = 0; idx < 4; ++idx) {
+		pool.emplace(idx);
+	}
+
+	for (auto frame = 0; frame < 10; ++frame) {
+		pool.eraseIf([](int value) { return value % 2 == 0; });
+		pool.emplace(0);
+		pool.emplace(2);
+	}
+
+	BOOST_CHECK_EQUAL(pool.size(), 4u);
+	BOOST_CHECK_EQUAL(pool.capacity(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(IteratesOverLiveObjectsInSlotOrder) {
+	auto pool = Pool<int>();
+
+	auto handles = std::vector<Pool<int>::Handle>();
+	for (auto idx = 0; idx < 5; ++idx) {
+		handles.emplace_back(pool.emplace(idx));
+	}
+	pool.erase(handles[1]);
+	pool.erase(handles[3]);
+
+	const auto& constPool = pool;
+	const auto values = std::vector<int>(constPool.begin(), constPool.end());
+	const auto expected = std::vector<int>({ 0, 2, 4 });
+	BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+
+	for (auto it = pool.begin(); it != pool.end(); ++it) {
+		BOOST_CHECK(pool.contains(it.handle()));
+		*it *= 10;
+	}
+	BOOST_CHECK_EQUAL(pool[handles[4]], 40);
+}
+
+BOOST_AUTO_TEST_CASE(KeepsHandlesValidWhenMoved) {
+	auto pool = Pool<int>();
+	const auto handle = pool.emplace(42);
+
+	auto moved = std::move(pool);
+
+	BOOST_CHECK_EQUAL(moved[handle], 42);
+	BOOST_CHECK(pool.empty());
+	BOOST_CHECK(!pool.contains(handle));
+}
+
+BOOST_AUTO_TEST_CASE(DestroysObjects) {
+	auto registry = test_utils::ConstructionRegistry();
+	const void* erased = nullptr;
+	const void* kept = nullptr;
+
+	{
+		auto pool = Pool<test_utils::ConstructionRegisteringObject>();
+
+		const auto erasedHandle = pool.emplace(registry);
+		erased = pool.get(erasedHandle);
+		kept = pool.get(pool.emplace(registry));
+
+		pool.erase(erasedHandle);
+		BOOST_CHECK(registry.objects[erased].destructed);
+		BOOST_CHECK(!registry.objects[kept].destructed);
+	}
+
+	BOOST_CHECK(registry.objects[kept].destructed);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* PoolTestSuite */);
+
+} // anonymous namespace
@@ -4,6 +4,8 @@
 #include "dormouse-engine/essentials/Singleton.hpp"
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -44,6 +46,35 @@ BOOST_AUTO_TEST_CASE(UsesProvidedInstance) {
 	BOOST_CHECK_EQUAL(constructed, ProvidedSingletonClass::instance().get());
 }
 
+class ConcurrentlyCreatedSingletonClass : public Singleton<ConcurrentlyCreatedSingletonClass> {
+};
+
+BOOST_AUTO_TEST_CASE(CreatesOneInstanceWhenAccessedConcurrently) {
+	auto instances = std::vector<ConcurrentlyCreatedSingletonClass*>(8u, nullptr);
+	auto threads = std::vector<std::thread>();
+
+	for (auto& instance : instances) {
+		threads.emplace_back([&instance]() {
+				instance = &ConcurrentlyCreatedSingletonClass::reference();
+			});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	for (const auto* instance : instances) {
+		BOOST_CHECK_EQUAL(instance, ConcurrentlyCreatedSingletonClass::instance().get());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReferenceFollowsReplacedInstance) {
+	ProvidedSingletonClass* constructed = new ProvidedSingletonClass;
+	ProvidedSingletonClass::setInstance(std::unique_ptr<ProvidedSingletonClass>(constructed));
+
+	BOOST_CHECK_EQUAL(constructed, &ProvidedSingletonClass::reference());
+}
+
 BOOST_AUTO_TEST_SUITE_END(/* SingletonTestSuite */);
 
 } // anonymous namespace
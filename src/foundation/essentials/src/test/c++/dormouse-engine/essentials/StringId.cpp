@@ -1,11 +1,17 @@
 #define BOOST_TEST_NO_LIB
 #include <boost/test/auto_unit_test.hpp>
 
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "dormouse-engine/essentials/StringId.hpp"
 
 namespace /* anonymous */ {
 
 using namespace dormouse_engine::essentials;
+using namespace dormouse_engine::essentials::string_id_literals;
 
 BOOST_AUTO_TEST_SUITE(StringIdTestSuite);
 
@@ -35,6 +41,64 @@ BOOST_AUTO_TEST_CASE(StringIdIsConstructibleFromString) {
 	BOOST_CHECK_EQUAL(fromString.string(), "from string");
 }
 
+BOOST_AUTO_TEST_CASE(LiteralsEqualStringIdsOfTheSameString) {
+	constexpr auto literal = "literal"_sid;
+
+	BOOST_CHECK(literal == StringId("literal"));
+	BOOST_CHECK(literal != "other literal"_sid);
+
+	Strings::setInstance(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(LiteralStringsCanBeRetrieved) {
+	const auto literal = "retrieved literal"_sid;
+	BOOST_CHECK_EQUAL(literal.string(), "retrieved literal");
+
+	Strings::setInstance(nullptr);
+	BOOST_CHECK_EQUAL(literal.string(), "retrieved literal");
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsOnUnknownHashes) {
+	const auto forgotten = Strings::instance()->add("forgotten");
+
+	Strings::setInstance(nullptr);
+	BOOST_CHECK_THROW(forgotten.string(), UnknownStringIdHash);
+}
+
+BOOST_AUTO_TEST_CASE(StringsMayBeAddedConcurrently) {
+	const auto threadCount = size_t(8);
+	const auto stringCount = size_t(1000);
+
+	Strings::setInstance(std::make_unique<Strings>());
+	auto strings = Strings::instance();
+	auto threads = std::vector<std::thread>();
+	auto ids = std::vector<std::vector<StringId>>(threadCount);
+
+	for (auto threadIdx = size_t(0); threadIdx < threadCount; ++threadIdx) {
+		threads.emplace_back([&strings, &ids, threadIdx, stringCount]() {
+				for (auto stringIdx = size_t(0); stringIdx < stringCount; ++stringIdx) {
+					ids[threadIdx].emplace_back(strings->add("string " + std::to_string(stringIdx)));
+				}
+			});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	BOOST_CHECK_EQUAL(strings->size(), stringCount);
+
+	for (const auto& threadIds : ids) {
+		BOOST_REQUIRE_EQUAL(threadIds.size(), stringCount);
+		for (auto stringIdx = size_t(0); stringIdx < stringCount; ++stringIdx) {
+			BOOST_CHECK(threadIds[stringIdx] == ids.front()[stringIdx]);
+			BOOST_CHECK_EQUAL(threadIds[stringIdx].string(), "string " + std::to_string(stringIdx));
+		}
+	}
+
+	Strings::setInstance(nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END(/* StringIdTestSuite */);
 
 } // anonymous namespace
@@ -0,0 +1,53 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "dormouse-engine/essentials/ThreadPool.hpp"
+
+using namespace dormouse_engine::essentials;
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTestSuite);
+
+BOOST_AUTO_TEST_CASE(ReturnsTaskResultsThroughFutures) {
+	auto threadPool = ThreadPool(4u);
+
+	auto results = std::vector<std::future<int>>();
+	for (auto idx = 0; idx < 100; ++idx) {
+		results.emplace_back(threadPool.submit([idx]() { return idx * idx; }));
+	}
+
+	for (auto idx = 0; idx < 100; ++idx) {
+		BOOST_CHECK_EQUAL(results[idx].get(), idx * idx);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PassesExceptionsThroughFutures) {
+	auto threadPool = ThreadPool(1u);
+
+	auto result = threadPool.submit([]() -> int { throw std::runtime_error("task failed"); });
+
+	BOOST_CHECK_THROW(result.get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(ExecutesRemainingTasksOnDestruction) {
+	auto executed = std::atomic<size_t>(0u);
+
+	{
+		auto threadPool = ThreadPool(2u);
+		for (auto idx = 0; idx < 50; ++idx) {
+			threadPool.submit([&executed]() { ++executed; });
+		}
+	}
+
+	BOOST_CHECK_EQUAL(executed.load(), 50u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* ThreadPoolTestSuite */);
+
+} // anonymous namespace
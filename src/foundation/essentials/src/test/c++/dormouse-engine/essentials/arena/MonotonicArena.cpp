@@ -0,0 +1,105 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "dormouse-engine/essentials/arena/CountingResource.hpp"
+#include "dormouse-engine/essentials/arena/MonotonicArena.hpp"
+
+namespace /* anonymous */ {
+
+using namespace dormouse_engine::essentials::arena;
+
+BOOST_AUTO_TEST_SUITE(ArenaTestSuite);
+BOOST_AUTO_TEST_SUITE(MonotonicArenaTestSuite);
+
+BOOST_AUTO_TEST_CASE(AllocatesAlignedMemory) {
+	auto arena = MonotonicArena(256u);
+
+	for (const auto alignment : { 1u, 2u, 4u, 8u, 16u, 64u }) {
+		arena.allocate(1u, 1u);
+		auto* p = arena.allocate(3u, alignment);
+		BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(p) % alignment, 0u);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReusesBlocksAfterReset) {
+	auto upstream = CountingResource();
+	auto arena = MonotonicArena(256u, &upstream);
+
+	for (auto frame = 0; frame < 10; ++frame) {
+		arena.reset();
+		for (auto idx = 0; idx < 100; ++idx) {
+			arena.allocate<int>(4u);
+		}
+	}
+
+	BOOST_CHECK_EQUAL(arena.statistics().allocations, 1000u);
+	BOOST_CHECK_EQUAL(upstream.statistics().allocations, arena.statistics().blockAllocations);
+
+	const auto blockAllocations = upstream.statistics().allocations;
+
+	arena.reset();
+	for (auto idx = 0; idx < 100; ++idx) {
+		arena.allocate<int>(4u);
+	}
+
+	BOOST_CHECK_EQUAL(upstream.statistics().allocations, blockAllocations);
+}
+
+BOOST_AUTO_TEST_CASE(GivesOversizedAllocationsABlockOfTheirOwn) {
+	auto upstream = CountingResource();
+
+	{
+		auto arena = MonotonicArena(64u, &upstream);
+
+		auto* small = static_cast<char*>(arena.allocate(16u));
+		auto* large = static_cast<char*>(arena.allocate(1024u));
+		std::fill(large, large + 1024u, 'x');
+
+		BOOST_CHECK_EQUAL(upstream.statistics().allocations, 2u);
+		BOOST_CHECK_GE(arena.capacity(), 64u + 1024u);
+		BOOST_CHECK(large < small || large >= small + 16u);
+	}
+
+	BOOST_CHECK_EQUAL(upstream.liveAllocations(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(RewindsToMarker) {
+	auto arena = MonotonicArena(64u);
+
+	arena.allocate(8u);
+	const auto marker = arena.mark();
+	auto* first = arena.allocate(32u);
+	arena.allocate(48u);
+
+	arena.rewind(marker);
+
+	BOOST_CHECK_EQUAL(arena.allocate(32u), first);
+}
+
+BOOST_AUTO_TEST_CASE(BacksPmrContainers) {
+	auto upstream = CountingResource();
+	auto arena = MonotonicArena(1024u, &upstream);
+
+	for (auto frame = 0; frame < 3; ++frame) {
+		arena.reset();
+
+		auto values = std::pmr::vector<int>(arena.resource());
+		for (auto idx = 0; idx < 100; ++idx) {
+			values.push_back(idx);
+		}
+
+		BOOST_CHECK_EQUAL(values.size(), 100u);
+		BOOST_CHECK_EQUAL(values.back(), 99);
+	}
+
+	BOOST_CHECK_EQUAL(upstream.statistics().allocations, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* MonotonicArenaTestSuite */);
+BOOST_AUTO_TEST_SUITE_END(/* ArenaTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,59 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "dormouse-engine/essentials/arena/scratch.hpp"
+
+namespace /* anonymous */ {
+
+using namespace dormouse_engine::essentials::arena;
+
+BOOST_AUTO_TEST_SUITE(ArenaTestSuite);
+BOOST_AUTO_TEST_SUITE(ScratchTestSuite);
+
+BOOST_AUTO_TEST_CASE(NestedScopesRewindInOrder) {
+	auto* outerAllocation = static_cast<void*>(nullptr);
+	auto* innerAllocation = static_cast<void*>(nullptr);
+
+	{
+		auto outer = ScratchScope();
+		outerAllocation = outer.allocate(16u);
+
+		{
+			auto inner = ScratchScope();
+			innerAllocation = inner.allocate(16u);
+			BOOST_CHECK_NE(innerAllocation, outerAllocation);
+		}
+
+		auto inner = ScratchScope();
+		BOOST_CHECK_EQUAL(inner.allocate(16u), innerAllocation);
+	}
+
+	auto scope = ScratchScope();
+	BOOST_CHECK_EQUAL(scope.allocate(16u), outerAllocation);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadsHaveSeparateArenas) {
+	auto* mainArena = &scratchArena();
+	auto* otherArena = static_cast<MonotonicArena*>(nullptr);
+
+	auto thread = std::thread([&otherArena]() { otherArena = &scratchArena(); });
+	thread.join();
+
+	BOOST_CHECK_NE(mainArena, otherArena);
+}
+
+BOOST_AUTO_TEST_CASE(ScopesBackPmrContainers) {
+	auto scope = ScratchScope();
+
+	auto values = std::pmr::vector<int>({ 1, 2, 3 }, scope.resource());
+
+	BOOST_CHECK_EQUAL(values.size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* ScratchTestSuite */);
+BOOST_AUTO_TEST_SUITE_END(/* ArenaTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,39 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include "dormouse-engine/essentials/hash-bytes.hpp"
+
+using namespace dormouse_engine::essentials;
+
+namespace /* anonymous */ {
+
+BOOST_AUTO_TEST_SUITE(DormouseEngineEssentialsHashBytesTestSuite);
+
+BOOST_AUTO_TEST_CASE(ReturnsReferenceFnv1aValues) {
+	static_assert(hashBytes("", 0u) == FNV1A_OFFSET_BASIS);
+	static_assert(hashBytes("a", 1u) == 0xaf63dc4c8601ec8cull);
+	BOOST_CHECK_EQUAL(hashBytes("foobar", 6u), 0x85944171f73967e8ull);
+}
+
+BOOST_AUTO_TEST_CASE(HashesSplitBuffersLikeContiguousOnes) {
+	const auto data = std::string("constant buffer data");
+
+	const auto first = hashBytes(data.data(), 8u);
+	const auto split = hashBytes(data.data() + 8u, data.size() - 8u, first);
+
+	BOOST_CHECK_EQUAL(split, hashBytes(data.data(), data.size()));
+}
+
+BOOST_AUTO_TEST_CASE(DifferentDataGivesDifferentHashes) {
+	const std::uint8_t zeros[] = { 0u, 0u, 0u, 0u };
+	const std::uint8_t one[] = { 0u, 0u, 0u, 1u };
+
+	BOOST_CHECK_NE(hashBytes(zeros, sizeof(zeros)), hashBytes(one, sizeof(one)));
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* DormouseEngineEssentialsHashBytesTestSuite */);
+
+} // anonymous namespace
@@ -0,0 +1,117 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include "dormouse-engine/essentials/radix-sort.hpp"
+
+using namespace dormouse_engine::essentials;
+
+namespace /* anonymous */ {
+
+struct Entry {
+	std::uint64_t key;
+	size_t order;
+};
+
+bool operator==(const Entry& lhs, const Entry& rhs) {
+	return lhs.key == rhs.key && lhs.order == rhs.order;
+}
+
+bool operator!=(const Entry& lhs, const Entry& rhs) {
+	return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const Entry& entry) {
+	return os << '(' << entry.key << ", " << entry.order << ')';
+}
+
+std::uint64_t entryKey(const Entry& entry) {
+	return entry.key;
+}
+
+std::vector<Entry> makeEntries(std::vector<std::uint64_t> keys) {
+	auto entries = std::vector<Entry>();
+	for (auto order = size_t(0); order < keys.size(); ++order) {
+		entries.emplace_back(Entry{ keys[order], order });
+	}
+	return entries;
+}
+
+std::vector<Entry> stableSorted(std::vector<Entry> entries) {
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+			return lhs.key < rhs.key;
+		});
+	return entries;
+}
+
+BOOST_AUTO_TEST_SUITE(DormouseEngineEssentialsRadixSortTestSuite);
+
+BOOST_AUTO_TEST_CASE(SortsEmptyAndSingleElementRanges) {
+	auto buffer = std::vector<Entry>();
+
+	auto empty = std::vector<Entry>();
+	radixSort(empty, buffer, &entryKey);
+	BOOST_CHECK(empty.empty());
+
+	auto single = makeEntries({ 42u });
+	const auto expected = single;
+	radixSort(single, buffer, &entryKey);
+	BOOST_CHECK_EQUAL_COLLECTIONS(single.begin(), single.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SortsRandomKeysLikeStableSort) {
+	auto generator = std::mt19937_64(1234u);
+	auto keys = std::vector<std::uint64_t>();
+	for (auto i = 0; i < 5000; ++i) {
+		// restrict some of the keys to a small range to get plenty of duplicates
+		keys.emplace_back(i % 3 == 0 ? generator() % 16u : generator());
+	}
+
+	auto entries = makeEntries(keys);
+	const auto expected = stableSorted(entries);
+
+	auto buffer = std::vector<Entry>();
+	radixSort(entries, buffer, &entryKey);
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SortsKeysDifferingInSingleByteColumn) {
+	const auto HIGH = std::uint64_t(0xABCDEF0000000000ull);
+	auto entries = makeEntries({ HIGH | 0x30000, HIGH | 0x10000, HIGH | 0x30000, HIGH, HIGH | 0x20000 });
+	const auto expected = stableSorted(entries);
+
+	auto buffer = std::vector<Entry>();
+	radixSort(entries, buffer, &entryKey);
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(LeavesEqualKeysInOriginalOrder) {
+	auto entries = makeEntries({ 7u, 7u, 7u, 7u });
+	const auto expected = entries;
+
+	auto buffer = std::vector<Entry>();
+	radixSort(entries, buffer, &entryKey);
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SortsNarrowKeys) {
+	auto values = std::vector<std::uint8_t>{ 5u, 255u, 0u, 17u, 5u };
+	auto buffer = std::vector<std::uint8_t>();
+
+	radixSort(values, buffer, [](std::uint8_t value) { return value; });
+
+	const auto expected = std::vector<std::uint8_t>{ 0u, 5u, 5u, 17u, 255u };
+	BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* DormouseEngineEssentialsRadixSortTestSuite */);
+
+} // anonymous namespace
@@ -1,12 +1,15 @@
 #ifndef DORMOUSEENGINE_LOGGER_CONTEXT_HPP_
 #define DORMOUSEENGINE_LOGGER_CONTEXT_HPP_
 
-#include <string>
+#include <string_view>
 
 #include "Category.hpp"
 
 namespace dormouse_engine::logger {
 
+// Refers to the category, file and function names rather than copying them, so that logging doesn't
+// allocate a context per message. The names need to outlive the context - DE_LOGGER_CONTEXT passes the
+// static category and string literals.
 struct Context {
 
 	static const Context& empty();
@@ -16,7 +19,7 @@ struct Context {
 	{
 	}
 
-	Context(const Category& category, const std::string& file, size_t line, const std::string& function) :
+	Context(std::string_view category, std::string_view file, size_t line, std::string_view function) :
 		category(category),
 		file(file),
 		line(line),
@@ -24,13 +27,13 @@ struct Context {
 	{
 	}
 
-	Category category;
+	std::string_view category;
 
-	std::string file;
+	std::string_view file;
 
 	size_t line;
 
-	std::string function;
+	std::string_view function;
 
 private:
 
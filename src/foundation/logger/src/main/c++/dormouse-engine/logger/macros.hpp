@@ -23,7 +23,7 @@
 
 #define DE_LOGGER_CONTEXT dormouse_engine::logger::Context(loggerCategory(dormouse_engine::logger::FakeParam()), __FILE__, __LINE__, DE_FUNCTION_NAME)
 
-#define DE_LOGGER dormouse_engine::logger::GlobalLoggerFactory::instance()->create(loggerCategory(dormouse_engine::logger::FakeParam()))
+#define DE_LOGGER dormouse_engine::logger::GlobalLoggerFactory::reference().create(loggerCategory(dormouse_engine::logger::FakeParam()))
 
 #define DE_LOG(LEVEL) \
 	if ((LEVEL) < (DE_LOGGER)->getLevel()) { \
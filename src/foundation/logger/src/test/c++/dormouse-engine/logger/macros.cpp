@@ -16,7 +16,7 @@ class CategoryPrintingLayout : public layout::Layout {
 public:
 
 	std::string format(Level, const Context& context, const std::string&) override {
-		return context.category + "\n";
+		return std::string(context.category) + "\n";
 	}
 
 };
@@ -65,6 +65,11 @@ workspace "dormouse-engine"
 
 	defines { "PONDER_STATIC" }
 	
+	if GRAPHICS_API == "null" then
+		-- tester then provides a headless rendering fixture and test main
+		defines { "DE_GRAPHICS_NULL" }
+	end
+	
 	include "foundation"
 	include "sdk-wrappers"
 	include "core"
@@ -18,6 +18,9 @@ class Device;
 
 const auto CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER = D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT;
 
+// Alignment of offsets and sizes of constant buffer ranges, i.e. 16 constants of 16 bytes.
+const auto CONSTANT_BUFFER_OFFSET_ALIGNMENT = size_t(256);
+
 class Buffer : public Resource {
 public:
 
@@ -20,13 +20,28 @@
 using namespace dormouse_engine;
 using namespace dormouse_engine::graphics;
 
+namespace /* anonymous */ {
+
+// Returns null if the runtime doesn't support Direct3D 11.1.
+system::windows::COMWrapper<ID3D11DeviceContext1> queryDeviceContext1(ID3D11DeviceContext* deviceContext) {
+	auto result = system::windows::COMWrapper<ID3D11DeviceContext1>();
+	if (deviceContext) {
+		deviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&result.get()));
+	}
+	return result;
+}
+
+} // anonymous namespace
+
 CommandList::CommandList(system::windows::COMWrapper<ID3D11DeviceContext> internalDeviceContext) :
-	deviceContext_(std::move(internalDeviceContext))
+	deviceContext_(std::move(internalDeviceContext)),
+	deviceContext1_(queryDeviceContext1(deviceContext_.get()))
 {
 }
 
 void CommandList::initialise(system::windows::COMWrapper<ID3D11DeviceContext> internalDeviceContext) {
 	deviceContext_ = internalDeviceContext;
+	deviceContext1_ = queryDeviceContext1(deviceContext_.get());
 }
 
 void CommandList::draw(size_t startingIndex, size_t vertexCount, PrimitiveTopology primitiveTopology) {
@@ -34,9 +49,12 @@ void CommandList::draw(size_t startingIndex, size_t vertexCount, PrimitiveTopolo
 	deviceContext_->Draw(static_cast<UINT>(vertexCount), static_cast<UINT>(startingIndex));
 }
 
-void CommandList::drawIndexed(size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology) {
+void CommandList::drawIndexed(
+	size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology, size_t baseVertex)
+{
 	deviceContext_->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(primitiveTopology));
-	deviceContext_->DrawIndexed(static_cast<UINT>(indexCount), static_cast<UINT>(startingIndex), 0);
+	deviceContext_->DrawIndexed(
+		static_cast<UINT>(indexCount), static_cast<UINT>(startingIndex), static_cast<INT>(baseVertex));
 }
 
 void CommandList::drawIndexedInstanced(size_t vertexCountPerInstance, size_t instanceCount,
@@ -146,6 +164,43 @@ void CommandList::setConstantBuffer(const Buffer& buffer, ShaderType stage, size
 	}
 }
 
+void CommandList::setConstantBuffer(
+	const Buffer& buffer, ShaderType stage, size_t slot, size_t offset, size_t size)
+{
+	assert(offset % CONSTANT_BUFFER_OFFSET_ALIGNMENT == 0u);
+	assert(size % CONSTANT_BUFFER_OFFSET_ALIGNMENT == 0u);
+
+	if (!deviceContext1_) {
+		throw dormouse_engine::exceptions::LogicError("Binding constant buffer ranges requires Direct3D 11.1");
+	}
+
+	auto* buf = static_cast<ID3D11Buffer*>(detail::Internals::dxResourcePtr(buffer));
+
+	// offsets and sizes are given in shader constants of 16 bytes
+	const auto firstConstant = static_cast<UINT>(offset / 16u);
+	const auto constantCount = static_cast<UINT>(size / 16u);
+
+	switch (stage) {
+	case ShaderType::VERTEX:
+		deviceContext1_->VSSetConstantBuffers1(static_cast<UINT>(slot), 1, &buf, &firstConstant, &constantCount);
+		break;
+	case ShaderType::GEOMETRY:
+		deviceContext1_->GSSetConstantBuffers1(static_cast<UINT>(slot), 1, &buf, &firstConstant, &constantCount);
+		break;
+	case ShaderType::HULL:
+		deviceContext1_->HSSetConstantBuffers1(static_cast<UINT>(slot), 1, &buf, &firstConstant, &constantCount);
+		break;
+	case ShaderType::DOMAIN:
+		deviceContext1_->DSSetConstantBuffers1(static_cast<UINT>(slot), 1, &buf, &firstConstant, &constantCount);
+		break;
+	case ShaderType::PIXEL:
+		deviceContext1_->PSSetConstantBuffers1(static_cast<UINT>(slot), 1, &buf, &firstConstant, &constantCount);
+		break;
+	default:
+		throw dormouse_engine::exceptions::LogicError("Unknown shader type: " + toString(stage));
+	}
+}
+
 void CommandList::setIndexBuffer(const Buffer& buffer, size_t offset, size_t stride) {
 	auto* buf = static_cast<ID3D11Buffer*>(detail::Internals::dxResourcePtr(buffer));
 
@@ -6,6 +6,7 @@
 #include <functional>
 
 #include <d3d11.h>
+#include <d3d11_1.h>
 #include "dormouse-engine/system/windows/cleanup-macros.hpp"
 
 #include "dormouse-engine/essentials/memory.hpp"
@@ -56,7 +57,9 @@ public:
 
 	void draw(size_t startingIndex, size_t vertexCount, PrimitiveTopology primitiveTopology);
 
-	void drawIndexed(size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology);
+	// baseVertex is added to each index before reading the vertex buffer.
+	void drawIndexed(
+		size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology, size_t baseVertex = 0u);
 
 	void drawIndexedInstanced(size_t vertexCountPerInstance, size_t instanceCount, size_t startingIndex,
 		PrimitiveTopology primitiveTopology);
@@ -85,6 +88,10 @@ public:
 
 	void setConstantBuffer(const Buffer& buffer, ShaderType stage, size_t slot);
 
+	// Binds size bytes of buffer starting at offset. Both must be multiples of
+	// CONSTANT_BUFFER_OFFSET_ALIGNMENT. Requires Direct3D 11.1.
+	void setConstantBuffer(const Buffer& buffer, ShaderType stage, size_t slot, size_t offset, size_t size);
+
 	void setIndexBuffer(const Buffer& buffer, size_t offset, size_t stride);
 
 	void setVertexBuffer(const Buffer& buffer, size_t slot, size_t stride);
@@ -99,6 +106,8 @@ private:
 
 	system::windows::COMWrapper<ID3D11DeviceContext> deviceContext_;
 
+	system::windows::COMWrapper<ID3D11DeviceContext1> deviceContext1_;
+
 	friend struct detail::Internals;
 
 };
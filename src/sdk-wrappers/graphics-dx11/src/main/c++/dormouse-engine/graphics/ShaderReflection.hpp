@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <tuple>
+#include <utility>
 
 #include <d3dcommon.h>
 #include "dormouse-engine/system/windows/cleanup-macros.hpp"
@@ -121,6 +122,15 @@ public:
 
 	ShaderReflection(const void* shaderData, size_t shaderSize);
 
+	// Creates reflection data read earlier, e.g. stored alongside the shader.
+	ShaderReflection(
+		InputParameterInfos inputParameters, ConstantBufferInfos constantBuffers, ResourceInfos resources) :
+		inputParameters_(std::move(inputParameters)),
+		constantBuffers_(std::move(constantBuffers)),
+		resources_(std::move(resources))
+	{
+	}
+
 	const InputParameterInfos& inputParameters() const {
 		return inputParameters_;
 	}
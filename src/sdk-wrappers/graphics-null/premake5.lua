@@ -0,0 +1,7 @@
+structure.library_project(
+	"graphics",
+	function()
+		includedirs { ponder_include_dir() }
+		links { "exceptions", "system", "logger" }
+	end
+	)
@@ -0,0 +1,34 @@
+#include "graphics.pch.hpp"
+
+#include "Buffer.hpp"
+
+#include "detail/ResourceData.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+namespace /* anonymous */ {
+
+std::shared_ptr<detail::ResourceData> createBufferData(
+	const Buffer::Configuration& configuration, essentials::ConstBufferView initialData)
+{
+	auto data = std::make_shared<detail::ResourceData>();
+
+	data->bytes.resize(configuration.size);
+	data->rowPitch = configuration.size;
+	data->depthPitch = configuration.size;
+
+	if (initialData.data()) {
+		assert(initialData.size() <= configuration.size);
+		std::memcpy(data->bytes.data(), initialData.data(), std::min(initialData.size(), configuration.size));
+	}
+
+	return data;
+}
+
+} // anonymous namespace
+
+Buffer::Buffer(Device& /*renderer*/, const Configuration& configuration, essentials::ConstBufferView initialData) :
+	Resource(createBufferData(configuration, initialData))
+{
+}
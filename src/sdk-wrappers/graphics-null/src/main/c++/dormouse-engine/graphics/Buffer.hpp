@@ -0,0 +1,55 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_BUFFER_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_BUFFER_HPP_
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "Resource.hpp"
+#include "ShaderType.hpp"
+#include "PixelFormat.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+
+// Same as D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+const auto CONSTANT_BUFFER_SLOT_COUNT_PER_SHADER = size_t(14);
+
+// Same as the Direct3D 11.1 requirement for constant buffer ranges, i.e. 16 constants of 16 bytes.
+const auto CONSTANT_BUFFER_OFFSET_ALIGNMENT = size_t(256);
+
+class Buffer : public Resource {
+public:
+
+	enum class CreationPurpose {
+		VERTEX_BUFFER,
+		INDEX_BUFFER,
+		CONSTANT_BUFFER,
+		SHADER_RESOURCE,
+	};
+
+	struct Configuration {
+
+		size_t size;
+
+		bool allowModifications;
+
+		bool allowCPURead;
+
+		bool allowGPUWrite;
+
+		CreationPurpose purpose;
+
+	};
+
+	Buffer() = default;
+
+	Buffer(
+		Device& renderer,
+		const Configuration& configuration,
+		essentials::ConstBufferView initialData = essentials::ConstBufferView()
+		);
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_BUFFER_HPP_ */
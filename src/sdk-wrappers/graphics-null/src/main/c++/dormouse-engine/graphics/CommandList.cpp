@@ -0,0 +1,169 @@
+#include "graphics.pch.hpp"
+
+#include "CommandList.hpp"
+
+#include <cassert>
+#include <numeric>
+
+#include "detail/Internals.hpp"
+#include "detail/ResourceData.hpp"
+#include "Buffer.hpp"
+#include "Texture.hpp"
+#include "RenderState.hpp"
+#include "Resource.hpp"
+#include "Sampler.hpp"
+#include "ShaderType.hpp"
+#include "InputLayout.hpp"
+#include "Viewport.hpp"
+#include "ScissorRect.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+CommandList::CommandList(bool recordCalls) :
+	recordCalls_(recordCalls)
+{
+}
+
+void CommandList::draw(size_t startingIndex, size_t vertexCount, PrimitiveTopology primitiveTopology) {
+	record_(CallType::DRAW, 0u, startingIndex, vertexCount, static_cast<size_t>(primitiveTopology));
+}
+
+void CommandList::drawIndexed(
+	size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology, size_t baseVertex)
+{
+	record_(
+		CallType::DRAW_INDEXED, 0u, startingIndex, indexCount, static_cast<size_t>(primitiveTopology), baseVertex);
+}
+
+void CommandList::drawIndexedInstanced(size_t vertexCountPerInstance, size_t instanceCount,
+	size_t startingIndex, PrimitiveTopology /*primitiveTopology*/)
+{
+	record_(CallType::DRAW_INDEXED_INSTANCED, 0u, vertexCountPerInstance, instanceCount, startingIndex);
+}
+
+CommandList::LockedData CommandList::lock(const Resource& data, LockPurpose lockPurpose) {
+	auto& resourceData = detail::Internals::resourceData(data);
+
+	record_(CallType::LOCK, data.id(), static_cast<size_t>(lockPurpose));
+
+	auto result = LockedData();
+
+	result.pixels = LockedData::Pixels(resourceData.bytes.data(), [](essentials::Byte*) {});
+	result.rowPitch = resourceData.rowPitch;
+	result.depthPitch = resourceData.depthPitch;
+
+	return result;
+}
+
+void CommandList::copy(const Resource& source, const Resource& target) {
+	const auto& sourceData = detail::Internals::resourceData(source);
+	auto& targetData = detail::Internals::resourceData(target);
+
+	record_(CallType::COPY, target.id(), source.id());
+
+	std::memcpy(
+		targetData.bytes.data(),
+		sourceData.bytes.data(),
+		std::min(sourceData.bytes.size(), targetData.bytes.size())
+		);
+}
+
+void CommandList::setRenderTarget(const RenderTargetView& renderTarget, const DepthStencilView& depthStencil) {
+	record_(
+		CallType::SET_RENDER_TARGET,
+		detail::Internals::objectId(renderTarget),
+		detail::Internals::objectId(depthStencil)
+		);
+}
+
+void CommandList::setViewport(const Viewport& /*viewport*/) {
+	record_(CallType::SET_VIEWPORT, 0u);
+}
+
+void CommandList::setScissorRect(const ScissorRect& /*scissorRect*/) {
+	record_(CallType::SET_SCISSOR_RECT, 0u);
+}
+
+void CommandList::setInputLayout(const InputLayout& inputLayout) noexcept {
+	record_(CallType::SET_INPUT_LAYOUT, detail::Internals::objectId(inputLayout));
+}
+
+void CommandList::setShader(const VertexShader& vertexShader) noexcept {
+	record_(CallType::SET_SHADER, detail::Internals::objectId(vertexShader), static_cast<size_t>(ShaderType::VERTEX));
+}
+
+void CommandList::setShader(const GeometryShader& geometryShader) noexcept {
+	record_(
+		CallType::SET_SHADER, detail::Internals::objectId(geometryShader), static_cast<size_t>(ShaderType::GEOMETRY));
+}
+
+void CommandList::setShader(const HullShader& hullShader) noexcept {
+	record_(CallType::SET_SHADER, detail::Internals::objectId(hullShader), static_cast<size_t>(ShaderType::HULL));
+}
+
+void CommandList::setShader(const DomainShader& domainShader) noexcept {
+	record_(CallType::SET_SHADER, detail::Internals::objectId(domainShader), static_cast<size_t>(ShaderType::DOMAIN));
+}
+
+void CommandList::setShader(const PixelShader& pixelShader) noexcept {
+	record_(CallType::SET_SHADER, detail::Internals::objectId(pixelShader), static_cast<size_t>(ShaderType::PIXEL));
+}
+
+void CommandList::setConstantBuffer(const Buffer& buffer, ShaderType stage, size_t slot) {
+	record_(CallType::SET_CONSTANT_BUFFER, buffer.id(), static_cast<size_t>(stage), slot);
+}
+
+void CommandList::setConstantBuffer(
+	const Buffer& buffer, ShaderType stage, size_t slot, size_t offset, size_t size)
+{
+	assert(offset % CONSTANT_BUFFER_OFFSET_ALIGNMENT == 0u);
+	assert(size % CONSTANT_BUFFER_OFFSET_ALIGNMENT == 0u);
+	assert(offset + size <= detail::Internals::resourceData(buffer).bytes.size());
+
+	record_(CallType::SET_CONSTANT_BUFFER, buffer.id(), static_cast<size_t>(stage), slot, offset);
+}
+
+void CommandList::setIndexBuffer(const Buffer& buffer, size_t offset, size_t stride) {
+	assert(stride == 2 || stride == 4);
+	record_(CallType::SET_INDEX_BUFFER, buffer.id(), offset, stride);
+}
+
+void CommandList::setVertexBuffer(const Buffer& buffer, size_t slot, size_t stride) {
+	record_(CallType::SET_VERTEX_BUFFER, buffer.id(), slot, stride);
+}
+
+void CommandList::setResource(const ResourceView& resourceView, ShaderType stage, size_t slot) {
+	record_(CallType::SET_RESOURCE, detail::Internals::objectId(resourceView), static_cast<size_t>(stage), slot);
+}
+
+void CommandList::setSampler(const Sampler& sampler, ShaderType stage, size_t slot) {
+	record_(CallType::SET_SAMPLER, detail::Internals::objectId(sampler), static_cast<size_t>(stage), slot);
+}
+
+void CommandList::setRenderState(const RenderState& renderState) {
+	record_(CallType::SET_RENDER_STATE, detail::Internals::objectId(renderState));
+}
+
+size_t CommandList::callCount() const noexcept {
+	return std::accumulate(callCounts_.begin(), callCounts_.end(), size_t(0));
+}
+
+void CommandList::clearCalls() noexcept {
+	calls_.clear();
+	callCounts_.fill(0u);
+}
+
+void CommandList::record_(
+	CallType type, std::uintptr_t object, size_t argument0, size_t argument1, size_t argument2, size_t argument3)
+{
+	++callCounts_[static_cast<size_t>(type)];
+
+	if (recordCalls_) {
+		auto call = Call();
+		call.type = type;
+		call.object = object;
+		call.arguments = { argument0, argument1, argument2, argument3 };
+		calls_.emplace_back(call);
+	}
+}
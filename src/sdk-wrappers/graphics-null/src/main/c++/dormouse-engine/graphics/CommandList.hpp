@@ -0,0 +1,181 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_COMMANDLIST_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_COMMANDLIST_HPP_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <functional>
+#include <vector>
+
+#include <boost/preprocessor/seq/size.hpp>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/enums.hpp"
+#include "detail/detailfwd.hpp"
+#include "PrimitiveTopology.hpp"
+#include "Shader.hpp"
+#include "ShaderType.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Buffer;
+class Resource;
+class Device;
+class Texture;
+class Sampler;
+class RenderState;
+class InputLayout;
+class Viewport;
+class ScissorRect;
+class PixelFormat;
+class RenderTargetView;
+class DepthStencilView;
+class ResourceView;
+
+// Command list which doesn't talk to any GPU. Each call is counted and, if requested, appended to an
+// in-memory stream, so that the renderer may be benchmarked and tested on machines without a device.
+class CommandList {
+public:
+
+	struct LockedData {
+		using Pixels = std::unique_ptr<essentials::Byte, std::function<void(essentials::Byte*)>>;
+
+		Pixels pixels;
+		size_t rowPitch;
+		size_t depthPitch;
+	};
+
+	enum class LockPurpose {
+		WRITE_DISCARD,
+		WRITE_NO_OVERWRITE,
+		READ,
+	};
+
+// Listed once, so that CALL_TYPE_COUNT, and with it the size of callCounts_, follows the enum
+#define DE_GRAPHICS_NULL_CALL_TYPES \
+		(DRAW) \
+		(DRAW_INDEXED) \
+		(DRAW_INDEXED_INSTANCED) \
+		(LOCK) \
+		(COPY) \
+		(SET_RENDER_TARGET) \
+		(SET_VIEWPORT) \
+		(SET_SCISSOR_RECT) \
+		(SET_INPUT_LAYOUT) \
+		(SET_SHADER) \
+		(SET_CONSTANT_BUFFER) \
+		(SET_INDEX_BUFFER) \
+		(SET_VERTEX_BUFFER) \
+		(SET_RESOURCE) \
+		(SET_SAMPLER) \
+		(SET_RENDER_STATE)
+
+	DE_MEMBER_ENUM(CallType, DE_GRAPHICS_NULL_CALL_TYPES);
+
+	static constexpr auto CALL_TYPE_COUNT = size_t(BOOST_PP_SEQ_SIZE(DE_GRAPHICS_NULL_CALL_TYPES));
+
+#undef DE_GRAPHICS_NULL_CALL_TYPES
+
+	// A recorded call. object identifies the bound object (the same objects give the same value), while
+	// arguments hold the call's numeric parameters in declaration order, with the shader stage first for
+	// per-stage bindings.
+	struct Call {
+
+		CallType type;
+
+		std::uintptr_t object = 0u;
+
+		std::array<size_t, 4> arguments = { 0u, 0u, 0u, 0u };
+
+	};
+
+	using Calls = std::vector<Call>;
+
+	CommandList() = default;
+
+	explicit CommandList(bool recordCalls);
+
+	void draw(size_t startingIndex, size_t vertexCount, PrimitiveTopology primitiveTopology);
+
+	// baseVertex is added to each index before reading the vertex buffer.
+	void drawIndexed(
+		size_t startingIndex, size_t indexCount, PrimitiveTopology primitiveTopology, size_t baseVertex = 0u);
+
+	void drawIndexedInstanced(size_t vertexCountPerInstance, size_t instanceCount, size_t startingIndex,
+		PrimitiveTopology primitiveTopology);
+
+	LockedData lock(const Resource& data, LockPurpose lockPurpose);
+
+	void copy(const Resource& source, const Resource& target);
+
+	void setRenderTarget(const RenderTargetView& renderTarget, const DepthStencilView& depthStencil);
+
+	void setViewport(const Viewport& viewport);
+
+	void setScissorRect(const ScissorRect& scissorRect);
+
+	void setInputLayout(const InputLayout& inputLayout) noexcept;
+
+	void setShader(const VertexShader& vertexShader) noexcept;
+
+	void setShader(const GeometryShader& geometryShader) noexcept;
+
+	void setShader(const HullShader& hullShader) noexcept;
+
+	void setShader(const DomainShader& domainShader) noexcept;
+
+	void setShader(const PixelShader& pixelShader) noexcept;
+
+	void setConstantBuffer(const Buffer& buffer, ShaderType stage, size_t slot);
+
+	// Binds size bytes of buffer starting at offset. Both must be multiples of
+	// CONSTANT_BUFFER_OFFSET_ALIGNMENT. Recorded as SET_CONSTANT_BUFFER with the offset as the third argument.
+	void setConstantBuffer(const Buffer& buffer, ShaderType stage, size_t slot, size_t offset, size_t size);
+
+	void setIndexBuffer(const Buffer& buffer, size_t offset, size_t stride);
+
+	void setVertexBuffer(const Buffer& buffer, size_t slot, size_t stride);
+
+	void setResource(const ResourceView& resource, ShaderType stage, size_t slot);
+
+	void setSampler(const Sampler& sampler, ShaderType stage, size_t slot);
+
+	void setRenderState(const RenderState& renderState);
+
+	// Empty unless constructed with recordCalls set to true.
+	const Calls& calls() const noexcept {
+		return calls_;
+	}
+
+	size_t callCount(CallType type) const noexcept {
+		return callCounts_[static_cast<size_t>(type)];
+	}
+
+	size_t callCount() const noexcept;
+
+	void clearCalls() noexcept;
+
+private:
+
+	bool recordCalls_ = false;
+
+	Calls calls_;
+
+	std::array<size_t, CALL_TYPE_COUNT> callCounts_ = {};
+
+	void record_(
+		CallType type,
+		std::uintptr_t object,
+		size_t argument0 = 0u,
+		size_t argument1 = 0u,
+		size_t argument2 = 0u,
+		size_t argument3 = 0u
+		);
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_COMMANDLIST_HPP_ */
@@ -0,0 +1,77 @@
+#include "graphics.pch.hpp"
+
+#include "Device.hpp"
+
+#include "detail/Internals.hpp"
+#include "detail/ResourceData.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+namespace /* anonymous */ {
+
+Texture::Configuration2d surfaceConfiguration(
+	const Device::Configuration& configuration,
+	PixelFormat pixelFormat,
+	Texture::CreationPurpose purpose
+	)
+{
+	auto surfaceConfig = Texture::Configuration2d();
+	surfaceConfig.width = configuration.width;
+	surfaceConfig.height = configuration.height;
+	surfaceConfig.allowGPUWrite = true;
+	surfaceConfig.allowCPURead = false;
+	surfaceConfig.allowModifications = false;
+	surfaceConfig.mipLevels = 1;
+	surfaceConfig.arraySize = 1;
+	surfaceConfig.pixelFormat = pixelFormat;
+	surfaceConfig.purposeFlags = purpose;
+	surfaceConfig.sampleCount = configuration.sampleCount;
+	surfaceConfig.sampleQuality = configuration.sampleQuality;
+
+	return surfaceConfig;
+}
+
+} // anonymous namespace
+
+Device::Device(const Configuration& configuration) :
+	configuration_(configuration),
+	immediateCommandList_(configuration.recordCalls)
+{
+	backBuffer_ = Texture(
+		*this,
+		surfaceConfiguration(configuration, FORMAT_R8G8B8A8_UNORM, Texture::CreationPurpose::RENDER_TARGET)
+		);
+	depthStencil_ = Texture(
+		*this,
+		surfaceConfiguration(configuration, FORMAT_D32_FLOAT, Texture::CreationPurpose::DEPTH_STENCIL)
+		);
+}
+
+Device::~Device() {
+	for (const auto& handler : deviceDestroyedHandlers_) {
+		handler();
+	}
+}
+
+CommandList& Device::getImmediateCommandList() {
+	return immediateCommandList_;
+}
+
+CommandList Device::createDeferredCommandList() {
+	return CommandList(configuration_.recordCalls);
+}
+
+void Device::beginScene() {
+}
+
+void Device::endScene() {
+	++frameCount_;
+}
+
+Device::LockedData Device::lock(Resource& data, LockPurpose /*lockPurpose*/) {
+	return LockedData(detail::Internals::resourceData(data).bytes.data(), [](void*) {});
+}
+
+void Device::submit(CommandList& /*commandList*/) {
+}
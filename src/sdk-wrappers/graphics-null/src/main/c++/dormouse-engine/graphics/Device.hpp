@@ -0,0 +1,113 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_DEVICE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_DEVICE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "detail/detailfwd.hpp"
+#include "Texture.hpp"
+#include "CommandList.hpp"
+#include "PrimitiveTopology.hpp"
+
+namespace dormouse_engine::graphics {
+
+// Headless device. Resources live in system memory and command lists record the calls made on them,
+// so it needs no window and runs on any platform.
+class Device {
+public:
+
+	constexpr static auto NDC_NEAR = -1.0f;
+
+	constexpr static auto VECTOR_IS_SINGLE_ROW_MATRIX = false;
+
+	constexpr static auto VECTOR_IS_SINGLE_COLUMN_MATRIX = !VECTOR_IS_SINGLE_ROW_MATRIX;
+
+	using DeviceDestroyedHandler = std::function<void()>;
+
+	using LockedData = std::unique_ptr<void, std::function<void(void*)>>;
+
+	enum class LockPurpose {
+		READ,
+		WRITE,
+		READ_WRITE,
+		WRITE_DISCARD,
+		WRITE_NO_OVERWRITE,
+	};
+
+	struct Configuration {
+
+		bool debugDevice;
+
+		bool fullscreen;
+
+		bool vsync;
+
+		std::uint32_t sampleCount;
+
+		std::uint32_t sampleQuality;
+
+		size_t width = 800u;
+
+		size_t height = 600u;
+
+		// Whether command lists created by this device store their calls, or only count them.
+		bool recordCalls = true;
+
+	};
+
+	explicit Device(const Configuration& configuration);
+
+	~Device();
+
+	void addDeviceDestroyedHandler(DeviceDestroyedHandler handler) {
+		deviceDestroyedHandlers_.emplace_back(std::move(handler));
+	}
+
+	CommandList& getImmediateCommandList();
+
+	CommandList createDeferredCommandList();
+
+	void beginScene();
+
+	void endScene();
+
+	void submit(CommandList& commandList);
+
+	LockedData lock(Resource& data, LockPurpose lockPurpose);
+
+	Texture backBuffer() const {
+		return backBuffer_;
+	}
+
+	Texture depthStencil() const {
+		return depthStencil_;
+	}
+
+	// Number of endScene calls so far.
+	size_t frameCount() const noexcept {
+		return frameCount_;
+	}
+
+private:
+
+	Configuration configuration_;
+
+	std::vector<DeviceDestroyedHandler> deviceDestroyedHandlers_;
+
+	CommandList immediateCommandList_;
+
+	Texture backBuffer_;
+
+	Texture depthStencil_;
+
+	size_t frameCount_ = 0u;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_DEVICE_HPP_ */
@@ -0,0 +1,45 @@
+#include "graphics.pch.hpp"
+
+#include "Image.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include "dormouse-engine/logger.hpp"
+#include "PixelFormat.hpp"
+
+DE_LOGGER_CATEGORY("DORMOUSE_ENGINE.GRAPHICS");
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+using namespace std::string_literals;
+
+ImageLoadingError::ImageLoadingError(const std::string& path, const std::string& message) :
+	dormouse_engine::exceptions::RuntimeError(buildMessage(path, message)),
+	path_(path)
+{
+}
+
+ImageLoadingError::ImageLoadingError(const std::string& path, const std::exception& cause) :
+	dormouse_engine::exceptions::RuntimeError(buildMessage(path, std::string()), cause),
+	path_(path)
+{
+}
+
+std::string ImageLoadingError::buildMessage(const std::string& path, const std::string& message) {
+	auto result = R"(Failed to load image ")" + path + R"(")";
+	if (!message.empty()) {
+		result += ": " + message;
+	}
+
+	return result;
+}
+
+Image Image::load(essentials::ConstBufferView /*data*/, const boost::filesystem::path& path) {
+	DE_LOG_DEBUG << "Loading image " << path;
+	throw ImageLoadingError(path.string(), "image decoding is not supported by the null graphics backend");
+}
+
+void Image::save(const boost::filesystem::path& path, size_t /*rowPitch*/) const {
+	throw exceptions::RuntimeError("Failed to save " + path.string() + ": not supported by the null graphics backend");
+}
@@ -0,0 +1,29 @@
+#include "graphics.pch.hpp"
+
+#include "InputLayout.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+InputLayout::Element::Element(
+	std::string semantic,
+	size_t semanticIndex,
+	PixelFormat format,
+	SlotType inputSlotType,
+	size_t instanceDataStepRate
+	) :
+	semantic(std::move(semantic)),
+	semanticIndex(semanticIndex),
+	format(format),
+	inputSlotType(inputSlotType),
+	instanceDataStepRate(instanceDataStepRate)
+{
+}
+
+InputLayout::InputLayout(
+	Device& /*device*/,
+	const Elements& elements
+	) :
+	elements_(std::make_shared<const Elements>(elements))
+{
+}
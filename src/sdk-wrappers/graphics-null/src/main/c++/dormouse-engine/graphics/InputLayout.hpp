@@ -0,0 +1,67 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_INPUTLAYOUT_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_INPUTLAYOUT_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dormouse-engine/enums.hpp"
+#include "detail/detailfwd.hpp"
+#include "PixelFormat.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+
+class InputLayout final {
+public:
+
+	DE_MEMBER_ENUM(
+		SlotType,
+		(PER_VERTEX_DATA)
+		(PER_INSTANCE_DATA)
+		);
+
+	struct Element {
+	public:
+
+		Element(
+			std::string semantic,
+			size_t semanticIndex,
+			PixelFormat format,
+			SlotType inputSlotType,
+			size_t instanceDataStepRate
+			);
+
+		std::string semantic;
+
+		size_t semanticIndex;
+
+		PixelFormat format;
+
+		SlotType inputSlotType;
+
+		size_t instanceDataStepRate;
+
+	};
+
+	using Elements = std::vector<Element>;
+
+	InputLayout() = default;
+
+	InputLayout(
+		Device& renderer,
+		const Elements& elements
+		);
+
+private:
+
+	std::shared_ptr<const Elements> elements_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_INPUTLAYOUT_HPP_ */
@@ -0,0 +1,21 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_PRIMITIVETOPOLOGY_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_PRIMITIVETOPOLOGY_HPP_
+
+#include <string>
+
+#include "dormouse-engine/enums.hpp"
+
+namespace dormouse_engine::graphics {
+
+DE_ENUM(
+	PrimitiveTopology,
+	(INVALID)
+	(POINT_LIST)
+	(TRIANGLE_LIST)
+	(TRIANGLE_STRIP)
+	(PATCH_LIST_4_CONTROL_POINTS)
+	);
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_PRIMITIVETOPOLOGY_HPP_ */
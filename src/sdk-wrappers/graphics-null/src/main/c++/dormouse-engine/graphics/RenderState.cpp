@@ -0,0 +1,11 @@
+#include "graphics.pch.hpp"
+
+#include "RenderState.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+RenderState::RenderState(Device& /*device*/, const Configuration& configuration) :
+	configuration_(std::make_shared<const Configuration>(configuration))
+{
+}
@@ -0,0 +1,55 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_RENDERSTATE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_RENDERSTATE_HPP_
+
+#include <memory>
+
+#include "detail/detailfwd.hpp"
+#include "dormouse-engine/enums.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+
+class RenderState {
+public:
+
+	DE_MEMBER_ENUM(
+		CullMode,
+		(BACK)
+		(FRONT)
+		(NONE)
+		);
+
+	DE_MEMBER_ENUM(
+		FillMode,
+		(SOLID)
+		(WIREFRAME)
+		);
+
+	struct Configuration {
+
+		CullMode cullMode = CullMode::BACK;
+
+		FillMode fillMode = FillMode::SOLID;
+
+		bool frontCounterClockwise = false;
+
+		bool blendingEnabled = false;
+
+	};
+
+	RenderState() = default;
+
+	RenderState(Device& renderer, const Configuration& configuration);
+
+private:
+
+	std::shared_ptr<const Configuration> configuration_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_RENDERSTATE_HPP_ */
@@ -0,0 +1,23 @@
+#include "graphics.pch.hpp"
+
+#include "Resource.hpp"
+
+#include "detail/Internals.hpp"
+#include "Buffer.hpp"
+#include "Texture.hpp"
+
+using namespace dormouse_engine::graphics;
+
+ResourceView::ResourceView(const Texture& texture) :
+	resource_(detail::Internals::resourceDataPtr(texture))
+{
+}
+
+ResourceView::ResourceView(const Buffer& buffer, PixelFormat /*elementFormat*/) :
+	resource_(detail::Internals::resourceDataPtr(buffer))
+{
+}
+
+Resource::Id ResourceView::resourceId() const {
+	return reinterpret_cast<Resource::Id>(resource_.get());
+}
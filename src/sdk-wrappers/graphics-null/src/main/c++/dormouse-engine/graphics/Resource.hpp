@@ -0,0 +1,66 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_RESOURCE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_RESOURCE_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "detail/detailfwd.hpp"
+#include "PixelFormat.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+class Buffer;
+class Texture;
+
+// Same as D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, so that the renderer behaves as with dx11
+const auto RESOURCE_SLOT_COUNT_PER_SHADER = size_t(128);
+
+class Resource {
+public:
+
+	using Id = std::uintptr_t;
+
+	Resource() = default;
+
+	Id id() const {
+		return reinterpret_cast<Id>(resource_.get());
+	}
+
+protected:
+
+	Resource(std::shared_ptr<detail::ResourceData> resource) :
+		resource_(std::move(resource))
+	{
+	}
+
+private:
+
+	std::shared_ptr<detail::ResourceData> resource_;
+
+	friend struct detail::Internals;
+
+};
+
+class ResourceView {
+public:
+
+	ResourceView() = default;
+
+	ResourceView(const Texture& texture);
+
+	ResourceView(const Buffer& buffer, PixelFormat elementFormat);
+
+	Resource::Id resourceId() const;
+
+private:
+
+	std::shared_ptr<detail::ResourceData> resource_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_RESOURCE_HPP_ */
@@ -0,0 +1,62 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SAMPLER_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SAMPLER_HPP_
+
+#include <memory>
+
+#include "dormouse-engine/enums.hpp"
+#include "detail/detailfwd.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+
+// Same as D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT
+const auto SAMPLER_SLOT_COUNT_PER_SHADER = size_t(16);
+
+class Sampler {
+public:
+
+	DE_MEMBER_ENUM(
+		AddressMode,
+		(CLAMP)
+		(WRAP)
+		(MIRROR)
+		(MIRROR_ONCE)
+		);
+
+	DE_MEMBER_ENUM(
+		Filter,
+		(MIN_MAG_MIP_POINT)
+		(MIN_MAG_MIP_LINEAR)
+		(MIN_MAG_LINEAR_MIP_POINT)
+		(ANISOTROPIC)
+		);
+
+	struct Configuration {
+
+		AddressMode addressModeU;
+
+		AddressMode addressModeV;
+
+		AddressMode addressModeW;
+
+		Filter filter;
+
+	};
+
+	Sampler() {
+	}
+
+	Sampler(Device& renderer, const Configuration& configuration);
+
+private:
+
+	std::shared_ptr<const Configuration> configuration_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SAMPLER_HPP_ */
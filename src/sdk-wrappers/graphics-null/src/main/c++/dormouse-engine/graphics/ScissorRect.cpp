@@ -0,0 +1,11 @@
+#include "graphics.pch.hpp"
+
+#include "ScissorRect.hpp"
+
+using namespace dormouse_engine::graphics;
+
+ScissorRect::ScissorRect(const Configuration& configuration) :
+	enabled_(true),
+	configuration_(configuration)
+{
+}
@@ -0,0 +1,39 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SCISSORRECT_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SCISSORRECT_HPP_
+
+#include "detail/detailfwd.hpp"
+
+namespace dormouse_engine::graphics {
+
+class ScissorRect {
+public:
+
+	struct Configuration {
+
+		int top;
+
+		int bottom;
+
+		int left;
+
+		int right;
+
+	};
+
+	ScissorRect() = default;
+
+	ScissorRect(const Configuration& configuration);
+
+private:
+
+	bool enabled_ = false;
+
+	Configuration configuration_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SCISSORRECT_HPP_ */
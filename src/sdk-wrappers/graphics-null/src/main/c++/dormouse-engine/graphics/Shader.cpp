@@ -0,0 +1,18 @@
+#include "graphics.pch.hpp"
+
+#include "Shader.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+template <ShaderType SHADER_TYPE_PARAM>
+detail::Shader<SHADER_TYPE_PARAM>::Shader(Device& /*device*/, essentials::ConstBufferView shaderData) :
+	shaderData_(std::make_shared<const essentials::ByteVector>(shaderData.data(), shaderData.data() + shaderData.size()))
+{
+}
+
+template class detail::Shader<ShaderType::VERTEX>;
+template class detail::Shader<ShaderType::GEOMETRY>;
+template class detail::Shader<ShaderType::HULL>;
+template class detail::Shader<ShaderType::DOMAIN>;
+template class detail::Shader<ShaderType::PIXEL>;
@@ -0,0 +1,44 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SHADER_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SHADER_HPP_
+
+#include <memory>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/graphics/ShaderType.hpp"
+#include "detail/detailfwd.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+
+namespace detail {
+
+template <ShaderType SHADER_TYPE_PARAM>
+class Shader {
+public:
+
+	static const auto SHADER_TYPE = SHADER_TYPE_PARAM;
+
+	Shader() = default;
+
+	Shader(Device& device, essentials::ConstBufferView shaderData);
+
+private:
+
+	std::shared_ptr<const essentials::ByteVector> shaderData_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace detail
+
+using VertexShader = detail::Shader<ShaderType::VERTEX>;
+using GeometryShader = detail::Shader<ShaderType::GEOMETRY>;
+using HullShader = detail::Shader<ShaderType::HULL>;
+using DomainShader = detail::Shader<ShaderType::DOMAIN>;
+using PixelShader = detail::Shader<ShaderType::PIXEL>;
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SHADER_HPP_ */
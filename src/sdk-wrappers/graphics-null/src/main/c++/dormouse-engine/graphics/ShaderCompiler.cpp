@@ -0,0 +1,25 @@
+#include "graphics.pch.hpp"
+
+#include "ShaderCompiler.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+const ShaderCompiler::CompilerFlags ShaderCompiler::FULL_DEBUG_MASK =
+	CompilerFlags() |
+	CompilerFlag::DEBUG |
+	CompilerFlag::SKIP_OPTIMISATION |
+	CompilerFlag::OPTIMISATION_LEVEL_0
+	;
+
+essentials::ByteVector ShaderCompiler::compile(
+	essentials::ConstBufferView code,
+	const std::string& /*name*/,
+	const std::string& /*entrypoint*/,
+	ShaderType /*type*/,
+	IncludeHandler /*includeHandler*/,
+	CompilerFlags /*instanceFlags*/
+	) const
+{
+	return essentials::ByteVector(code.data(), code.data() + code.size());
+}
@@ -0,0 +1,56 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SHADERCOMPILER_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SHADERCOMPILER_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/enums/Mask.hpp"
+#include "ShaderType.hpp"
+
+namespace dormouse_engine::graphics {
+
+// Stands in for the shader compiler, returning the shader code as its compiled object.
+class ShaderCompiler {
+public:
+
+	using IncludeHandler = std::function<std::shared_ptr<essentials::ByteVector>(const std::string&)>;
+
+	DE_MEMBER_FLAG(
+		CompilerFlag,
+		(DEBUG)
+		(SKIP_OPTIMISATION)
+		(OPTIMISATION_LEVEL_0)
+		(OPTIMISATION_LEVEL_1)
+		(OPTIMISATION_LEVEL_2)
+		(OPTIMISATION_LEVEL_3)
+		);
+
+	using CompilerFlags = dormouse_engine::Mask<CompilerFlag>;
+
+	static const CompilerFlags FULL_DEBUG_MASK;
+
+	ShaderCompiler(CompilerFlags globalFlags = CompilerFlags()) :
+		globalCompilerFlags_(globalFlags)
+	{
+	}
+
+	essentials::ByteVector compile(
+		essentials::ConstBufferView code,
+		const std::string& name,
+		const std::string& entrypoint,
+		ShaderType type,
+		IncludeHandler includeHandler = IncludeHandler(),
+		CompilerFlags instanceFlags = CompilerFlags()
+		) const;
+
+private:
+
+	CompilerFlags globalCompilerFlags_;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SHADERCOMPILER_HPP_ */
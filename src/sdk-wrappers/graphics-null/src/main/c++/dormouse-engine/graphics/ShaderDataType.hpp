@@ -0,0 +1,69 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SHADERDATATYPE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SHADERDATATYPE_HPP_
+
+#pragma warning(push, 3)
+#	include <ponder/pondertype.hpp>
+#pragma warning(pop)
+
+#include "dormouse-engine/enums.hpp"
+
+namespace dormouse_engine::graphics {
+
+struct ShaderDataType {
+
+	DE_MEMBER_ENUM(
+		Class,
+		(SCALAR)
+		(VECTOR)
+		(MATRIX_ROW_MAJOR)
+		(MATRIX_COLUMN_MAJOR)
+		(OBJECT)
+		(STRUCT)
+	);
+
+	DE_MEMBER_ENUM(
+		ScalarType,
+		(EMPTY)
+		(BOOL)
+		(INT)
+		(UINT)
+		(FLOAT)
+	);
+
+	ShaderDataType() = default;
+
+	ShaderDataType(Class klass, ScalarType scalarType, size_t columns, size_t rows) :
+		klass(klass),
+		scalarType(scalarType),
+		columns(columns),
+		rows(rows)
+	{
+	}
+
+	Class klass;
+	ScalarType scalarType;
+	size_t columns;
+	size_t rows;
+};
+
+namespace detail {
+
+void declareShaderDataTypeClass();
+void declareShaderDataTypeScalarType();
+void declareShaderDataType();
+
+} // namespace detail
+
+} // namespace dormouse_engine::graphics
+
+PONDER_AUTO_TYPE(
+	dormouse_engine::graphics::ShaderDataType::Class,
+	&dormouse_engine::graphics::detail::declareShaderDataTypeClass
+	);
+PONDER_AUTO_TYPE(
+	dormouse_engine::graphics::ShaderDataType::ScalarType,
+	&dormouse_engine::graphics::detail::declareShaderDataTypeScalarType
+	);
+PONDER_AUTO_TYPE(dormouse_engine::graphics::ShaderDataType, &dormouse_engine::graphics::detail::declareShaderDataType);
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SHADERDATATYPE_HPP_ */
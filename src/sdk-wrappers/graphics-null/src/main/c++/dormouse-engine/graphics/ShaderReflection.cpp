@@ -0,0 +1,9 @@
+#include "graphics.pch.hpp"
+
+#include "ShaderReflection.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+ShaderReflection::ShaderReflection(const void* /*shaderData*/, size_t /*shaderSize*/) {
+}
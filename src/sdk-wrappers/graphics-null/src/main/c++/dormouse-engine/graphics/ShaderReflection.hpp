@@ -0,0 +1,155 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SHADERREFLECTION_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SHADERREFLECTION_HPP_
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+
+#include "dormouse-engine/enums.hpp"
+#include "ShaderDataType.hpp"
+
+namespace dormouse_engine::graphics {
+
+// Reflection of null shaders, which carry no metadata - all of the lists are empty.
+class ShaderReflection {
+public:
+
+	struct InputParameterInfo {
+
+		DE_MEMBER_ENUM(
+			DataType,
+			(FLOAT)
+			(UINT)
+			(INT)
+			);
+
+		std::string semantic;
+
+		size_t semanticIndex;
+
+		DataType dataType;
+
+		size_t elements;
+
+	};
+
+	using InputParameterInfos = std::vector<InputParameterInfo>;
+
+	struct Type {
+
+		using Member = std::tuple<std::string, Type>;
+
+		static const size_t MemberNameTag = 0;
+
+		static const size_t MemberTypeTag = 1;
+
+		using Members = std::vector<Member>;
+
+		std::string name;
+
+		size_t offset;
+
+		ShaderDataType dataType;
+
+		size_t elements;
+
+		size_t elementOffset;
+
+		Members members;
+
+	};
+
+	struct Variable {
+
+		Type type;
+
+		std::string name;
+
+		size_t offset;
+
+		size_t size;
+
+	};
+
+	struct ConstantBufferInfo {
+
+		using Variables = std::vector<Variable>;
+
+		std::string name;
+
+		size_t size;
+
+		size_t slot;
+
+		Variables variables;
+
+	};
+
+	using ConstantBufferInfos = std::vector<ConstantBufferInfo>;
+
+	struct ResourceInfo {
+
+		DE_MEMBER_ENUM(
+			Type,
+			(SAMPLER)
+			(TEXTURE)
+			);
+
+		DE_MEMBER_ENUM(
+			Dimension,
+			(UNKNOWN)
+			(BUFFER)
+			(TEXTURE1D)
+			(TEXTURE2D)
+			(TEXTURE_CUBE)
+			);
+
+		Type type;
+
+		std::string name;
+
+		size_t slot;
+
+		Dimension dimension;
+
+	};
+
+	using ResourceInfos = std::vector<ResourceInfo>;
+
+	ShaderReflection(const void* shaderData, size_t shaderSize);
+
+	// Creates reflection data read earlier, e.g. stored alongside the shader.
+	ShaderReflection(
+		InputParameterInfos inputParameters, ConstantBufferInfos constantBuffers, ResourceInfos resources) :
+		inputParameters_(std::move(inputParameters)),
+		constantBuffers_(std::move(constantBuffers)),
+		resources_(std::move(resources))
+	{
+	}
+
+	const InputParameterInfos& inputParameters() const {
+		return inputParameters_;
+	}
+
+	const ConstantBufferInfos& constantBuffers() const {
+		return constantBuffers_;
+	}
+
+	const ResourceInfos& resources() const {
+		return resources_;
+	}
+
+private:
+
+	InputParameterInfos inputParameters_;
+
+	ConstantBufferInfos constantBuffers_;
+
+	ResourceInfos resources_;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SHADERREFLECTION_HPP_ */
@@ -0,0 +1,26 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_SHADERTYPE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_SHADERTYPE_HPP_
+
+#include "dormouse-engine/enums.hpp"
+
+#pragma warning(push, 3)
+#	include <ponder/pondertype.hpp>
+#pragma warning(pop)
+
+namespace dormouse_engine::graphics {
+
+DE_ENUM(ShaderType,
+	(VERTEX)
+	(GEOMETRY)
+	(HULL)
+	(DOMAIN)
+	(PIXEL)
+	);
+
+namespace detail { void declareShaderType(); }
+
+} // namespace dormouse_engine::graphics
+
+PONDER_AUTO_TYPE(dormouse_engine::graphics::ShaderType, dormouse_engine::graphics::detail::declareShaderType);
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_SHADERTYPE_HPP_ */
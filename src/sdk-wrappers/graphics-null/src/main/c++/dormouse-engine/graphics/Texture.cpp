@@ -0,0 +1,89 @@
+#include "graphics.pch.hpp"
+
+#include "Texture.hpp"
+
+#include "detail/Internals.hpp"
+#include "detail/ResourceData.hpp"
+#include "Device.hpp"
+#include "Image.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+namespace /* anonymous */ {
+
+// Mip levels past the first are not stored, as nothing reads them back
+std::shared_ptr<detail::ResourceData> createTextureData(
+	const Texture::Configuration1d& configuration,
+	size_t height,
+	essentials::ConstBufferView initialData
+	)
+{
+	auto data = std::make_shared<detail::ResourceData>();
+
+	data->pixelFormat = configuration.pixelFormat;
+	data->rowPitch = configuration.pixelFormat.rowPitch(configuration.width);
+	data->depthPitch = configuration.pixelFormat.slicePitch(height, data->rowPitch);
+	data->bytes.resize(data->depthPitch * configuration.arraySize);
+
+	if (initialData.data()) {
+		std::memcpy(data->bytes.data(), initialData.data(), std::min(initialData.size(), data->bytes.size()));
+	}
+
+	return data;
+}
+
+Texture::Configuration2d imageConfiguration(const Image& image) {
+	auto configuration = Texture::Configuration2d();
+
+	configuration.width = image.size().first;
+	configuration.height = image.size().second;
+	configuration.arraySize = image.arraySize();
+	configuration.mipLevels = image.mipLevels();
+	configuration.pixelFormat = image.pixelFormat();
+	configuration.allowModifications = false;
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.purposeFlags = Texture::CreationPurpose::SHADER_RESOURCE;
+
+	return configuration;
+}
+
+} // anonymous namespace
+
+Texture::Texture(Device& /*device*/, const Configuration1d& configuration, essentials::ConstBufferView initialData) :
+	Resource(createTextureData(configuration, 1u, initialData))
+{
+}
+
+Texture::Texture(Device& /*device*/, const Configuration2d& configuration, essentials::ConstBufferView initialData) :
+	Resource(createTextureData(configuration, configuration.height, initialData))
+{
+}
+
+Texture::Texture(Device& device, const Image& image) :
+	Texture(device, imageConfiguration(image), image.pixels())
+{
+}
+
+PixelFormat Texture::pixelFormat() const {
+	return detail::Internals::resourceData(*this).pixelFormat;
+}
+
+RenderTargetView::RenderTargetView(const Texture& texture) :
+	resource_(detail::Internals::resourceDataPtr(texture))
+{
+}
+
+Resource::Id RenderTargetView::resourceId() const {
+	return reinterpret_cast<Resource::Id>(resource_.get());
+}
+
+DepthStencilView::DepthStencilView(const Texture& texture) :
+	resource_(detail::Internals::resourceDataPtr(texture))
+{
+}
+
+Resource::Id DepthStencilView::resourceId() const {
+	return reinterpret_cast<Resource::Id>(resource_.get());
+}
@@ -0,0 +1,113 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_TEXTURE_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_TEXTURE_HPP_
+
+#include <memory>
+
+#include "detail/detailfwd.hpp"
+#include "dormouse-engine/essentials/memory.hpp"
+#include "dormouse-engine/enums/Mask.hpp"
+#include "PixelFormat.hpp"
+#include "Resource.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Device;
+class Image;
+
+class Texture : public Resource {
+public:
+
+	DE_MEMBER_FLAG(
+		CreationPurpose,
+		(SHADER_RESOURCE)
+		(RENDER_TARGET)
+		(DEPTH_STENCIL)
+		);
+
+	struct Configuration1d {
+
+		size_t width;
+
+		size_t arraySize = 1u;
+
+		size_t mipLevels = 1u;
+
+		PixelFormat pixelFormat;
+
+		bool allowModifications;
+
+		bool allowCPURead;
+
+		bool allowGPUWrite;
+
+		dormouse_engine::Mask<CreationPurpose> purposeFlags;
+
+	};
+
+	struct Configuration2d : Configuration1d {
+
+		size_t height;
+
+		size_t sampleCount = 1u;
+
+		size_t sampleQuality = 0u;
+
+	};
+
+	Texture() = default;
+
+	Texture(
+		Device& device,
+		const Configuration1d& configuration,
+		essentials::ConstBufferView initialData = essentials::ConstBufferView()
+		);
+
+	Texture(
+		Device& device,
+		const Configuration2d& configuration,
+		essentials::ConstBufferView initialData = essentials::ConstBufferView()
+		);
+
+	Texture(Device& device, const Image& image);
+
+	graphics::PixelFormat pixelFormat() const;
+
+};
+
+class RenderTargetView {
+public:
+
+	RenderTargetView() = default;
+
+	RenderTargetView(const Texture& texture);
+
+	Resource::Id resourceId() const;
+
+private:
+
+	std::shared_ptr<detail::ResourceData> resource_;
+
+	friend struct detail::Internals;
+
+};
+
+class DepthStencilView {
+public:
+
+	DepthStencilView() = default;
+
+	DepthStencilView(const Texture& texture);
+
+	Resource::Id resourceId() const;
+
+private:
+
+	std::shared_ptr<detail::ResourceData> resource_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_TEXTURE_HPP_ */
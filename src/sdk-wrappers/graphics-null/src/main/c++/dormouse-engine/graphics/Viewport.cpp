@@ -0,0 +1,11 @@
+#include "graphics.pch.hpp"
+
+#include "Viewport.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+Viewport::Viewport(const Configuration& configuration) :
+	configuration_(configuration)
+{
+}
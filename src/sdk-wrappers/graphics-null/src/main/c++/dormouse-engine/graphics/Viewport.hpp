@@ -0,0 +1,41 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_VIEWPORT_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_VIEWPORT_HPP_
+
+#include "detail/detailfwd.hpp"
+
+namespace dormouse_engine::graphics {
+
+class Viewport {
+public:
+
+	struct Configuration {
+
+		float width;
+
+		float height;
+
+		float minDepth;
+
+		float maxDepth;
+
+		float topLeftX;
+
+		float topLeftY;
+
+	};
+
+	Viewport() = default;
+
+	Viewport(const Configuration& configuration);
+
+private:
+
+	Configuration configuration_;
+
+	friend struct detail::Internals;
+
+};
+
+} // namespace dormouse_engine::graphics
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_VIEWPORT_HPP_ */
@@ -0,0 +1,61 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_INTERNALS_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_INTERNALS_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "../Resource.hpp"
+#include "../Texture.hpp"
+#include "../InputLayout.hpp"
+#include "../Sampler.hpp"
+#include "../RenderState.hpp"
+#include "../Shader.hpp"
+#include "ResourceData.hpp"
+
+namespace dormouse_engine::graphics::detail {
+
+struct Internals {
+
+	static ResourceData& resourceData(const Resource& resource) {
+		assert(resource.resource_);
+		return *resource.resource_;
+	}
+
+	static std::shared_ptr<ResourceData> resourceDataPtr(const Resource& resource) {
+		return resource.resource_;
+	}
+
+	static std::uintptr_t objectId(const ResourceView& resourceView) {
+		return reinterpret_cast<std::uintptr_t>(resourceView.resource_.get());
+	}
+
+	static std::uintptr_t objectId(const RenderTargetView& renderTargetView) {
+		return reinterpret_cast<std::uintptr_t>(renderTargetView.resource_.get());
+	}
+
+	static std::uintptr_t objectId(const DepthStencilView& depthStencilView) {
+		return reinterpret_cast<std::uintptr_t>(depthStencilView.resource_.get());
+	}
+
+	static std::uintptr_t objectId(const InputLayout& inputLayout) {
+		return reinterpret_cast<std::uintptr_t>(inputLayout.elements_.get());
+	}
+
+	static std::uintptr_t objectId(const Sampler& sampler) {
+		return reinterpret_cast<std::uintptr_t>(sampler.configuration_.get());
+	}
+
+	static std::uintptr_t objectId(const RenderState& renderState) {
+		return reinterpret_cast<std::uintptr_t>(renderState.configuration_.get());
+	}
+
+	template <ShaderType SHADER_TYPE>
+	static std::uintptr_t objectId(const Shader<SHADER_TYPE>& shader) {
+		return reinterpret_cast<std::uintptr_t>(shader.shaderData_.get());
+	}
+
+};
+
+} // namespace dormouse_engine::graphics::detail
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_INTERNALS_HPP_ */
@@ -0,0 +1,25 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_RESOURCEDATA_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_RESOURCEDATA_HPP_
+
+#include "dormouse-engine/essentials/memory.hpp"
+#include "../PixelFormat.hpp"
+
+namespace dormouse_engine::graphics::detail {
+
+// System memory standing in for a GPU resource. Locking the resource returns a pointer into it, so data
+// written by the renderer may be inspected by tests.
+struct ResourceData {
+
+	essentials::ByteVector bytes;
+
+	PixelFormat pixelFormat;
+
+	size_t rowPitch = 0u;
+
+	size_t depthPitch = 0u;
+
+};
+
+} // namespace dormouse_engine::graphics::detail
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_RESOURCEDATA_HPP_ */
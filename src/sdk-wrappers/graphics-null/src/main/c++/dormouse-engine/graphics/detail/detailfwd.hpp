@@ -0,0 +1,12 @@
+#ifndef _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_DETAILFWD_HPP_
+#define _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_DETAILFWD_HPP_
+
+namespace dormouse_engine::graphics::detail {
+
+struct Internals;
+
+struct ResourceData;
+
+} // namespace dormouse_engine::graphics::detail
+
+#endif /* _DORMOUSEENGINE_GRAPHICS_NULL_DETAIL_DETAILFWD_HPP_ */
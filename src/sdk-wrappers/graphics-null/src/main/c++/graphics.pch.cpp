@@ -0,0 +1 @@
+#include "graphics.pch.hpp"
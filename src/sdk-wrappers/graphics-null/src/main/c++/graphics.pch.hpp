@@ -0,0 +1,25 @@
+#ifndef DORMOUSEENGINE_GRAPHICS_GRAPHICS_PCH_HPP_
+#define DORMOUSEENGINE_GRAPHICS_GRAPHICS_PCH_HPP_
+
+#include <functional>
+#include <cassert>
+#include <cstring>
+#include <unordered_set>
+#include <unordered_map>
+#include <array>
+#include <memory>
+#include <tuple>
+#include <algorithm>
+#include <vector>
+
+#include <boost/operators.hpp>
+
+#include "dormouse-engine/exceptions/LogicError.hpp"
+#include "dormouse-engine/exceptions/RuntimeError.hpp"
+#include "dormouse-engine/essentials/types.hpp"
+#include "dormouse-engine/enums.hpp"
+#include "dormouse-engine/logger.hpp"
+
+#include "dormouse-engine/graphics/PixelFormat.hpp"
+
+#endif /* DORMOUSEENGINE_GRAPHICS_GRAPHICS_PCH_HPP_ */
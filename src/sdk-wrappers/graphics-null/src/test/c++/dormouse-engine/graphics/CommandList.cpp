@@ -0,0 +1,129 @@
+#define BOOST_TEST_NO_LIB
+#include <boost/test/auto_unit_test.hpp>
+
+#include <array>
+#include <cstring>
+
+#include "dormouse-engine/graphics/Buffer.hpp"
+#include "dormouse-engine/graphics/CommandList.hpp"
+#include "dormouse-engine/graphics/Device.hpp"
+#include "dormouse-engine/graphics/Sampler.hpp"
+
+using namespace dormouse_engine;
+using namespace dormouse_engine::graphics;
+
+namespace /* anonymous */ {
+
+Device::Configuration deviceConfiguration(bool recordCalls) {
+	auto configuration = Device::Configuration();
+	configuration.debugDevice = false;
+	configuration.fullscreen = false;
+	configuration.vsync = false;
+	configuration.sampleCount = 1u;
+	configuration.sampleQuality = 0u;
+	configuration.recordCalls = recordCalls;
+	return configuration;
+}
+
+Buffer createConstantBuffer(Device& device, size_t size) {
+	auto configuration = Buffer::Configuration();
+	configuration.allowCPURead = false;
+	configuration.allowGPUWrite = false;
+	configuration.allowModifications = true;
+	configuration.purpose = Buffer::CreationPurpose::CONSTANT_BUFFER;
+	configuration.size = size;
+	return Buffer(device, configuration);
+}
+
+Sampler createSampler(Device& device) {
+	auto configuration = Sampler::Configuration();
+	configuration.addressModeU = Sampler::AddressMode::WRAP;
+	configuration.addressModeV = Sampler::AddressMode::WRAP;
+	configuration.addressModeW = Sampler::AddressMode::WRAP;
+	configuration.filter = Sampler::Filter::MIN_MAG_MIP_LINEAR;
+	return Sampler(device, configuration);
+}
+
+BOOST_AUTO_TEST_SUITE(GraphicsNullCommandListTestSuite);
+
+BOOST_AUTO_TEST_CASE(RecordsCallsInOrder) {
+	auto device = Device(deviceConfiguration(true));
+	auto& commandList = device.getImmediateCommandList();
+
+	const auto buffer = createConstantBuffer(device, 16u);
+	const auto sampler = createSampler(device);
+
+	commandList.setConstantBuffer(buffer, ShaderType::PIXEL, 2u);
+	commandList.setSampler(sampler, ShaderType::VERTEX, 1u);
+	commandList.draw(0u, 4u, PrimitiveTopology::TRIANGLE_STRIP);
+
+	const auto& calls = commandList.calls();
+	BOOST_REQUIRE_EQUAL(calls.size(), 3u);
+
+	BOOST_CHECK(calls[0].type == CommandList::CallType::SET_CONSTANT_BUFFER);
+	BOOST_CHECK_EQUAL(calls[0].object, buffer.id());
+	BOOST_CHECK_EQUAL(calls[0].arguments[0], static_cast<size_t>(ShaderType::PIXEL));
+	BOOST_CHECK_EQUAL(calls[0].arguments[1], 2u);
+
+	BOOST_CHECK(calls[1].type == CommandList::CallType::SET_SAMPLER);
+	BOOST_CHECK_NE(calls[1].object, 0u);
+	BOOST_CHECK_EQUAL(calls[1].arguments[1], 1u);
+
+	BOOST_CHECK(calls[2].type == CommandList::CallType::DRAW);
+	BOOST_CHECK_EQUAL(calls[2].arguments[1], 4u);
+}
+
+BOOST_AUTO_TEST_CASE(CountsCallsPerType) {
+	auto device = Device(deviceConfiguration(true));
+	auto& commandList = device.getImmediateCommandList();
+
+	const auto buffer = createConstantBuffer(device, 16u);
+
+	commandList.setVertexBuffer(buffer, 0u, 16u);
+	commandList.draw(0u, 3u, PrimitiveTopology::TRIANGLE_LIST);
+	commandList.draw(3u, 3u, PrimitiveTopology::TRIANGLE_LIST);
+
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::DRAW), 2u);
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::SET_VERTEX_BUFFER), 1u);
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::SET_SAMPLER), 0u);
+	BOOST_CHECK_EQUAL(commandList.callCount(), 3u);
+
+	commandList.clearCalls();
+
+	BOOST_CHECK(commandList.calls().empty());
+	BOOST_CHECK_EQUAL(commandList.callCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(CountsWithoutStoringIfNotRecording) {
+	auto device = Device(deviceConfiguration(false));
+	auto& commandList = device.getImmediateCommandList();
+
+	commandList.draw(0u, 3u, PrimitiveTopology::TRIANGLE_LIST);
+
+	BOOST_CHECK(commandList.calls().empty());
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::DRAW), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(LockedDataIsStoredInResource) {
+	auto device = Device(deviceConfiguration(true));
+	auto& commandList = device.getImmediateCommandList();
+
+	const auto source = createConstantBuffer(device, 16u);
+	const auto target = createConstantBuffer(device, 16u);
+
+	const auto data = std::array<float, 4>{ 1.0f, 2.0f, 3.0f, 4.0f };
+	std::memcpy(commandList.lock(source, CommandList::LockPurpose::WRITE_DISCARD).pixels.get(), data.data(), 16u);
+
+	commandList.copy(source, target);
+
+	auto read = std::array<float, 4>();
+	std::memcpy(read.data(), commandList.lock(target, CommandList::LockPurpose::READ).pixels.get(), 16u);
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(read.begin(), read.end(), data.begin(), data.end());
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::LOCK), 2u);
+	BOOST_CHECK_EQUAL(commandList.callCount(CommandList::CallType::COPY), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END(/* GraphicsNullCommandListTestSuite */);
+
+} // anonymous namespace